@@ -0,0 +1,99 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Result of one measured case of a benchmark.
+ */
+struct BenchmarkResult
+{
+  std::string benchmark;  // Registered benchmark name
+  std::string label;      // Case inside the benchmark (e.g. "legacy/lookup")
+  std::size_t size;       // Problem size (entity count, bullet count, ...)
+  double nsPerOp;         // Best-of-repetitions time per operation
+  double opsPerSecond;
+};
+
+/**
+ * @brief Handed to each benchmark run; owns the problem size and collects results.
+ */
+class BenchmarkContext
+{
+public:
+  BenchmarkContext(std::string name, std::size_t size, int repetitions)
+      : name(std::move(name)), problemSize(size), repetitions(repetitions) {}
+
+  std::size_t size() const { return problemSize; }
+
+  /**
+   * @brief Time body() and record the best run as ns per operation.
+   * @param opsPerRun Number of logical operations one call of body() performs.
+   */
+  template <typename F>
+  void measure(const std::string &label, std::size_t opsPerRun, F &&body)
+  {
+    body(); // Warm-up: fault in pages, fill caches
+
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i)
+    {
+      auto start = std::chrono::steady_clock::now();
+      body();
+      auto end = std::chrono::steady_clock::now();
+      double ns = std::chrono::duration<double, std::nano>(end - start).count();
+      best = (i == 0) ? ns : std::min(best, ns);
+    }
+
+    double nsPerOp = best / static_cast<double>(std::max<std::size_t>(opsPerRun, 1));
+    results.push_back({name, label, problemSize, nsPerOp, nsPerOp > 0.0 ? 1e9 / nsPerOp : 0.0});
+  }
+
+  const std::vector<BenchmarkResult> &getResults() const { return results; }
+
+private:
+  std::string name;
+  std::size_t problemSize;
+  int repetitions;
+  std::vector<BenchmarkResult> results;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkContext &)>;
+
+struct BenchmarkDefinition
+{
+  std::string name;
+  std::vector<std::size_t> sizes;
+  BenchmarkFunction function;
+};
+
+std::vector<BenchmarkDefinition> &getBenchmarkRegistry();
+
+/**
+ * @brief Registers a benchmark at static-initialization time.
+ */
+struct BenchmarkRegistrar
+{
+  BenchmarkRegistrar(const std::string &name, std::vector<std::size_t> sizes, BenchmarkFunction function)
+  {
+    getBenchmarkRegistry().push_back({name, std::move(sizes), std::move(function)});
+  }
+};
+
+/**
+ * @brief Keeps the optimizer from discarding a computed value.
+ */
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+#define REGISTER_BENCHMARK(name, sizes, function) \
+  static BenchmarkRegistrar BENCHMARK_CONCAT(benchmarkRegistrar_, __LINE__)(name, sizes, function)
@@ -0,0 +1,101 @@
+#include "Benchmark.hpp"
+#include "../src/core/Blackboard.hpp"
+#include <any>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+  // Replica of the original Blackboard (string -> std::any) used as the
+  // baseline. The original also wrote a line to std::cout with std::endl on
+  // every set(); that is left out here, so the baseline is optimistic.
+  class LegacyBlackboard
+  {
+  public:
+    void set(const std::string &key, const std::any &value) { data[key] = value; }
+
+    template <typename T>
+    T getValue(const std::string &key) const
+    {
+      auto it = data.find(key);
+      if (it != data.end())
+      {
+        try
+        {
+          return std::any_cast<T>(it->second);
+        }
+        catch (const std::bad_any_cast &)
+        {
+          return T{};
+        }
+      }
+      return T{};
+    }
+
+    template <typename T>
+    void setValue(const std::string &key, const T &value) { set(key, std::any(value)); }
+
+    bool has(const std::string &key) const { return data.find(key) != data.end(); }
+
+  private:
+    std::unordered_map<std::string, std::any> data;
+  };
+
+  const std::vector<std::size_t> OP_COUNTS = {1000, 100000};
+
+  // The per-frame pattern: one producer sets a flag, one consumer checks it
+  void blackboardAccess(BenchmarkContext &ctx)
+  {
+    const std::size_t ops = ctx.size();
+
+    LegacyBlackboard legacy;
+    ctx.measure("legacy/setValue", ops, [&]()
+                {
+                    for (std::size_t i = 0; i < ops; ++i)
+                        legacy.setValue("hud_toggle_request", (i & 1) != 0);
+                });
+
+    ctx.measure("legacy/has+getValue", ops, [&]()
+                {
+                    int count = 0;
+                    for (std::size_t i = 0; i < ops; ++i)
+                        count += legacy.has("hud_toggle_request") && legacy.getValue<bool>("hud_toggle_request");
+                    doNotOptimize(count);
+                });
+
+    Blackboard blackboard;
+    BlackboardKey<bool> key("hud_toggle_request");
+    blackboard.declare(key, false);
+
+    ctx.measure("interned/set", ops, [&]()
+                {
+                    for (std::size_t i = 0; i < ops; ++i)
+                        blackboard.set(key, (i & 1) != 0);
+                });
+
+    ctx.measure("interned/get", ops, [&]()
+                {
+                    int count = 0;
+                    for (std::size_t i = 0; i < ops; ++i)
+                        count += blackboard.get(key);
+                    doNotOptimize(count);
+                });
+
+    // String-keyed convenience API on the new blackboard (interns per call)
+    ctx.measure("string/setValue", ops, [&]()
+                {
+                    for (std::size_t i = 0; i < ops; ++i)
+                        blackboard.setValue("hud_toggle_request", (i & 1) != 0);
+                });
+
+    ctx.measure("string/getValue", ops, [&]()
+                {
+                    int count = 0;
+                    for (std::size_t i = 0; i < ops; ++i)
+                        count += blackboard.getValue<bool>("hud_toggle_request");
+                    doNotOptimize(count);
+                });
+  }
+}
+
+REGISTER_BENCHMARK("blackboard/access", OP_COUNTS, blackboardAccess);
@@ -0,0 +1,170 @@
+#include "Benchmark.hpp"
+#include "../src/core/Components.hpp"
+#include "../src/core/Manager.hpp"
+#include <memory>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+  // Replica of the original storage (type_index -> entity -> shared_ptr<void>)
+  // kept here as the baseline the sparse-set pools are compared against.
+  struct LegacyComponentStore
+  {
+    std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> stores;
+
+    template <typename T>
+    void add(Entity entity, const T &component)
+    {
+      stores[typeid(T)][entity] = std::make_shared<T>(component);
+    }
+
+    template <typename T>
+    T *get(Entity entity)
+    {
+      auto typeIt = stores.find(typeid(T));
+      if (typeIt == stores.end())
+        return nullptr;
+      auto it = typeIt->second.find(entity);
+      return it != typeIt->second.end() ? static_cast<T *>(it->second.get()) : nullptr;
+    }
+  };
+
+  const std::vector<std::size_t> ENTITY_COUNTS = {10000, 100000, 1000000};
+
+  std::vector<Entity> makeEntities(std::size_t count)
+  {
+    std::vector<Entity> entities(count);
+    std::iota(entities.begin(), entities.end(), Entity{1});
+    return entities;
+  }
+
+  // Lookups in random order, like systems probing arbitrary entities
+  std::vector<Entity> shuffled(std::vector<Entity> entities)
+  {
+    std::mt19937 rng(1234);
+    std::shuffle(entities.begin(), entities.end(), rng);
+    return entities;
+  }
+
+  void legacyStore(BenchmarkContext &ctx)
+  {
+    std::vector<Entity> entities = makeEntities(ctx.size());
+    std::vector<Entity> lookupOrder = shuffled(entities);
+    LegacyComponentStore store;
+
+    ctx.measure("legacy/add", entities.size(), [&]()
+                {
+                    store.stores.clear();
+                    for (Entity e : entities)
+                        store.add(e, Position{1.0f, 2.0f});
+                });
+
+    ctx.measure("legacy/lookup", lookupOrder.size(), [&]()
+                {
+                    float sum = 0.0f;
+                    for (Entity e : lookupOrder)
+                        sum += store.get<Position>(e)->x;
+                    doNotOptimize(sum);
+                });
+
+    ctx.measure("legacy/iterate", entities.size(), [&]()
+                {
+                    float sum = 0.0f;
+                    for (auto &[entity, component] : store.stores[typeid(Position)])
+                        sum += static_cast<Position *>(component.get())->x;
+                    doNotOptimize(sum);
+                });
+  }
+
+  void sparseSetStore(BenchmarkContext &ctx)
+  {
+    std::vector<Entity> entities = makeEntities(ctx.size());
+    std::vector<Entity> lookupOrder = shuffled(entities);
+    ComponentPool<Position> &pool = getComponentPool<Position>();
+
+    ctx.measure("sparse/add", entities.size(), [&]()
+                {
+                    pool.clear();
+                    for (Entity e : entities)
+                        addComponent(e, Position{1.0f, 2.0f});
+                });
+
+    ctx.measure("sparse/lookup", lookupOrder.size(), [&]()
+                {
+                    float sum = 0.0f;
+                    for (Entity e : lookupOrder)
+                        sum += getComponent<Position>(e)->x;
+                    doNotOptimize(sum);
+                });
+
+    ctx.measure("sparse/iterate", entities.size(), [&]()
+                {
+                    float sum = 0.0f;
+                    for (const Position &pos : pool.components())
+                        sum += pos.x;
+                    doNotOptimize(sum);
+                });
+
+    pool.clear();
+  }
+
+  // Per-frame access pattern of the physics/render loops: three component
+  // lookups per entity. Compares resolving the pool through a type_index hash
+  // (the previous keying) with the dense componentTypeId/static pool path.
+  void typeIdLookup(BenchmarkContext &ctx)
+  {
+    std::vector<Entity> entities = makeEntities(ctx.size());
+    for (Entity e : entities)
+    {
+      addComponent(e, Position{1.0f, 2.0f});
+      addComponent(e, Velocity{3.0f, 4.0f});
+      addComponent(e, Renderable{"white", 8, 8, false});
+    }
+
+    std::unordered_map<std::type_index, IComponentPool *> hashedPools = {
+        {typeid(Position), &getComponentPool<Position>()},
+        {typeid(Velocity), &getComponentPool<Velocity>()},
+        {typeid(Renderable), &getComponentPool<Renderable>()}};
+    auto hashedGet = [&](auto *tag, Entity e)
+    {
+      using T = std::remove_pointer_t<decltype(tag)>;
+      return static_cast<ComponentPool<T> *>(hashedPools.find(typeid(T))->second)->get(e);
+    };
+
+    ctx.measure("type_index/get3", entities.size() * 3, [&]()
+                {
+                    float sum = 0.0f;
+                    for (Entity e : entities)
+                        sum += hashedGet(static_cast<Position *>(nullptr), e)->x +
+                               hashedGet(static_cast<Velocity *>(nullptr), e)->x +
+                               hashedGet(static_cast<Renderable *>(nullptr), e)->width;
+                    doNotOptimize(sum);
+                });
+
+    ctx.measure("type_id/get3", entities.size() * 3, [&]()
+                {
+                    float sum = 0.0f;
+                    for (Entity e : entities)
+                        sum += getComponent<Position>(e)->x + getComponent<Velocity>(e)->x +
+                               getComponent<Renderable>(e)->width;
+                    doNotOptimize(sum);
+                });
+
+    getComponentPool<Position>().clear();
+    getComponentPool<Velocity>().clear();
+    getComponentPool<Renderable>().clear();
+  }
+}
+
+REGISTER_BENCHMARK("ecs/component_store", ENTITY_COUNTS, [](BenchmarkContext &ctx)
+                   {
+                       legacyStore(ctx);
+                       sparseSetStore(ctx);
+                   });
+
+REGISTER_BENCHMARK("ecs/type_lookup", (std::vector<std::size_t>{1000, 10000, 100000}), typeIdLookup);
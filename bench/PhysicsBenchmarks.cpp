@@ -0,0 +1,187 @@
+#include "Benchmark.hpp"
+#include "../src/core/Manager.hpp"
+#include "../src/core/ThreadPool.hpp"
+#include "../src/physics/PhysicsSystem.hpp"
+#include <box2d/box2d.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int STEPS_PER_RUN = 30;
+    constexpr float STEP_DT = 1.0f / 60.0f;
+    constexpr float BOX_HALF_SIZE = 0.25f; // Metres (16 px obstacles)
+    constexpr float SPACING = 1.0f;        // Metres between box centres at spawn
+
+    // 1, 2, 4, ... up to every hardware thread
+    std::vector<int> threadCounts()
+    {
+        int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<int> counts;
+        for (int threads = 1; threads < hardware; threads *= 2)
+        {
+            counts.push_back(threads);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+
+    // Walled arena filled with boxes moving in random directions. Restitution
+    // and no friction keep them bouncing, and sleep is off, so every step does
+    // the same amount of contact and solver work.
+    void populateArena(b2WorldId worldId, std::size_t count)
+    {
+        const int perRow = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+        const float arena = perRow * SPACING;
+
+        b2BodyDef wallDef = b2DefaultBodyDef();
+        wallDef.type = b2_staticBody;
+        b2ShapeDef wallShape = b2DefaultShapeDef();
+        const b2Vec2 wallCentres[] = {{arena * 0.5f, -0.5f}, {arena * 0.5f, arena + 0.5f},
+                                      {-0.5f, arena * 0.5f}, {arena + 0.5f, arena * 0.5f}};
+        for (int i = 0; i < 4; ++i)
+        {
+            wallDef.position = wallCentres[i];
+            b2BodyId wallId = b2CreateBody(worldId, &wallDef);
+            b2Polygon wall = (i < 2) ? b2MakeBox(arena * 0.5f + 1.0f, 0.5f) : b2MakeBox(0.5f, arena * 0.5f + 1.0f);
+            b2CreatePolygonShape(wallId, &wallShape, &wall);
+        }
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> speed(-3.0f, 3.0f);
+
+        b2BodyDef bodyDef = b2DefaultBodyDef();
+        bodyDef.type = b2_dynamicBody;
+        bodyDef.enableSleep = false;
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        shapeDef.density = 2.0f;
+        shapeDef.material.friction = 0.0f;
+        shapeDef.material.restitution = 1.0f;
+        b2Polygon box = b2MakeBox(BOX_HALF_SIZE, BOX_HALF_SIZE);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            bodyDef.position = {(static_cast<int>(i % perRow) + 0.5f) * SPACING,
+                                (static_cast<int>(i / perRow) + 0.5f) * SPACING};
+            bodyDef.linearVelocity = {speed(rng), speed(rng)};
+            b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
+            b2CreatePolygonShape(bodyId, &shapeDef, &box);
+        }
+    }
+
+    // b2World_Step cost of the same scene as the solver gets more threads.
+    // The world is owned by a PhysicsSystem so the steps go through the
+    // engine's own task callbacks and thread pool.
+    void worldStepScaling(BenchmarkContext &ctx)
+    {
+        Manager manager;
+
+        for (int threads : threadCounts())
+        {
+            // The calling thread takes part, so N threads means N - 1 workers
+            std::unique_ptr<ThreadPool> pool;
+            if (threads > 1)
+            {
+                pool = std::make_unique<ThreadPool>(threads - 1);
+            }
+
+            PhysicsSystem physics(&manager, pool.get());
+            populateArena(physics.getWorldId(), ctx.size());
+
+            ctx.measure("world_step/threads=" + std::to_string(threads), STEPS_PER_RUN, [&]()
+                        {
+                            for (int step = 0; step < STEPS_PER_RUN; ++step)
+                                b2World_Step(physics.getWorldId(), STEP_DT, 4);
+                        });
+        }
+    }
+
+    // One second of bullet churn at size() shots per second: each tick spawns
+    // its share of bullet bodies, steps, and retires the ones older than the
+    // lifetime. "create_destroy" is what PhysicsSystem did before bodies were
+    // pooled; "pooled" goes through its BodyPool, which is warm after the
+    // first run, so the measured runs do no Box2D body allocation.
+    void bulletBodyChurn(BenchmarkContext &ctx)
+    {
+        constexpr int TICKS = 60;
+        constexpr int LIFETIME_TICKS = 30;
+        const std::size_t perTick = std::max<std::size_t>(1, ctx.size() / TICKS);
+
+        Manager manager;
+        PhysicsSystem physics(&manager);
+        const BodyPool::TemplateId bullet = physics.getBulletTemplate();
+        BodyPool pool;
+        const BodyPool::TemplateId pooledBullet = pool.addTemplate(physics.getBodyPool().getTemplate(bullet));
+
+        auto run = [&](auto spawn, auto retire)
+        {
+            std::vector<std::vector<b2BodyId>> ages(LIFETIME_TICKS);
+            for (int tick = 0; tick < TICKS; ++tick)
+            {
+                std::vector<b2BodyId> &slot = ages[tick % LIFETIME_TICKS];
+                for (b2BodyId bodyId : slot)
+                    retire(bodyId);
+                slot.clear();
+
+                for (std::size_t i = 0; i < perTick; ++i)
+                {
+                    float offset = static_cast<float>(i % 64) * 0.5f;
+                    slot.push_back(spawn(b2Vec2{offset, offset}, b2Vec2{10.0f, 0.0f}));
+                }
+                b2World_Step(physics.getWorldId(), STEP_DT, 4);
+            }
+            for (std::vector<b2BodyId> &slot : ages)
+            {
+                for (b2BodyId bodyId : slot)
+                    retire(bodyId);
+            }
+        };
+
+        const BodyTemplate &shape = physics.getBodyPool().getTemplate(bullet);
+        ctx.measure("create_destroy", perTick * TICKS, [&]()
+                    {
+                        run(
+                            [&](b2Vec2 position, b2Vec2 velocity)
+                            {
+                                b2BodyDef bodyDef = b2DefaultBodyDef();
+                                bodyDef.type = b2_dynamicBody;
+                                bodyDef.isBullet = true;
+                                bodyDef.position = position;
+                                bodyDef.linearVelocity = velocity;
+                                b2BodyId bodyId = b2CreateBody(physics.getWorldId(), &bodyDef);
+                                b2Circle circle = {{0.0f, 0.0f}, shape.radius};
+                                b2ShapeDef shapeDef = b2DefaultShapeDef();
+                                shapeDef.density = shape.density;
+                                shapeDef.isSensor = true;
+                                shapeDef.enableSensorEvents = true;
+                                b2CreateCircleShape(bodyId, &shapeDef, &circle);
+                                return bodyId;
+                            },
+                            [](b2BodyId bodyId)
+                            {
+                                b2DestroyBody(bodyId);
+                            });
+                    });
+
+        ctx.measure("pooled", perTick * TICKS, [&]()
+                    {
+                        run(
+                            [&](b2Vec2 position, b2Vec2 velocity)
+                            {
+                                return pool.acquire(physics.getWorldId(), pooledBullet, position, velocity, nullptr);
+                            },
+                            [&](b2BodyId bodyId)
+                            {
+                                pool.release(pooledBullet, bodyId);
+                            });
+                    });
+    }
+}
+
+REGISTER_BENCHMARK("physics/world_step", (std::vector<std::size_t>{10000, 20000}), worldStepScaling);
+REGISTER_BENCHMARK("physics/bullet_bodies", (std::vector<std::size_t>{500, 5000}), bulletBodyChurn);
@@ -0,0 +1,254 @@
+#include "Benchmark.hpp"
+#include "../src/core/CommandBuffer.hpp"
+#include "../src/core/Components.hpp"
+#include "../src/core/Events.hpp"
+#include "../src/core/Manager.hpp"
+#include "../src/gameplay/ProjectilePool.hpp"
+#include "../src/gameplay/ShootingSystem.hpp"
+#include "../src/physics/PhysicsSystem.hpp"
+#include <cmath>
+#include <random>
+#include <string>
+
+namespace
+{
+    constexpr int TICKS_PER_RUN = 30;
+    constexpr float TICK_DT = 1.0f / 60.0f;
+    constexpr int OBSTACLE_COLUMNS = 16;
+    constexpr int OBSTACLE_ROWS = 12;
+
+    // The game's 800x600 arena with a grid of 24x24 obstacles, driven tick by
+    // tick the way GameEngine does it: shooting, physics, command flush.
+    // Bullets that hit something or leave the arena are replaced every tick,
+    // so the live count stays at the problem size and the spawn/destroy
+    // churn of each mode is part of the measurement.
+    struct ProjectileScene
+    {
+        Manager manager;
+        CommandBuffer commands{&manager};
+        Events events;
+        ProjectilePool pool;
+        ShootingSystem shooting{&manager};
+        PhysicsSystem physics{&manager};
+        std::mt19937 rng{99};
+
+        ProjectileScene()
+        {
+            for (System *system : {static_cast<System *>(&shooting), static_cast<System *>(&physics)})
+            {
+                system->setEvents(&events);
+                system->setCommandBuffer(&commands);
+            }
+            shooting.setProjectilePool(&pool);
+            physics.setProjectilePool(&pool);
+
+            for (int row = 0; row < OBSTACLE_ROWS; ++row)
+            {
+                for (int column = 0; column < OBSTACLE_COLUMNS; ++column)
+                {
+                    Entity obstacle = manager.createEntity();
+                    addComponent(obstacle, Position{25.0f + column * 50.0f, 25.0f + row * 50.0f});
+                    addComponent(obstacle, Velocity{0.0f, 0.0f});
+                    addComponent(obstacle, Renderable{"red", 24, 24, false});
+                    physics.addEntity(obstacle);
+                }
+            }
+        }
+
+        ~ProjectileScene()
+        {
+            manager.destroyEntities(manager.getAllEntities());
+        }
+
+        std::size_t liveBullets(ProjectileMode mode) const
+        {
+            return mode == ProjectileMode::RayCast ? pool.size() : getComponentPool<Bullet>().size();
+        }
+
+        void topUp(ProjectileMode mode, std::size_t target)
+        {
+            std::uniform_real_distribution<float> x(0.0f, 800.0f);
+            std::uniform_real_distribution<float> y(0.0f, 600.0f);
+            std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+            for (std::size_t live = liveBullets(mode); live < target; ++live)
+            {
+                shooting.spawnProjectile(x(rng), y(rng), angle(rng), mode);
+            }
+        }
+
+        void tick(ProjectileMode mode, std::size_t target)
+        {
+            topUp(mode, target);
+            shooting.update(TICK_DT);
+            physics.update(TICK_DT);
+
+            commands.flush();
+            if (!commands.getDestroyedEntities().empty())
+            {
+                shooting.onEntitiesDestroyed(commands.getDestroyedEntities());
+                physics.onEntitiesDestroyed(commands.getDestroyedEntities());
+            }
+            events.clear();
+        }
+    };
+
+    void projectileModes(BenchmarkContext &ctx)
+    {
+        const std::pair<const char *, ProjectileMode> modes[] = {{"body_per_bullet", ProjectileMode::Body},
+                                                                 {"ray_cast_pool", ProjectileMode::RayCast}};
+        for (const auto &[label, mode] : modes)
+        {
+            ProjectileScene scene;
+            scene.topUp(mode, ctx.size());
+
+            ctx.measure(std::string(label) + "/tick", TICKS_PER_RUN, [&]()
+                        {
+                            for (int tick = 0; tick < TICKS_PER_RUN; ++tick)
+                                scene.tick(mode, ctx.size());
+                        });
+        }
+    }
+
+    // The array-of-structs layout ProjectilePool used before, kept here as
+    // the baseline: one loop that integrates, tests and swap-removes as it goes
+    struct AosProjectile
+    {
+        float x, y, prevX, prevY, vx, vy, timeAlive, lifetime;
+    };
+
+    void integrateAos(std::vector<AosProjectile> &projectiles, float dt, float minX, float minY, float maxX,
+                      float maxY)
+    {
+        std::size_t i = 0;
+        while (i < projectiles.size())
+        {
+            AosProjectile &projectile = projectiles[i];
+            projectile.prevX = projectile.x;
+            projectile.prevY = projectile.y;
+            projectile.x += projectile.vx * dt;
+            projectile.y += projectile.vy * dt;
+            projectile.timeAlive += dt;
+
+            if (projectile.timeAlive >= projectile.lifetime || projectile.x < minX || projectile.x > maxX ||
+                projectile.y < minY || projectile.y > maxY)
+            {
+                projectiles[i] = projectiles.back();
+                projectiles.pop_back();
+                continue;
+            }
+            ++i;
+        }
+    }
+
+    // Random bullets for the integration benchmark; same seed for every layout
+    struct Spawner
+    {
+        std::mt19937 rng{7};
+        std::uniform_real_distribution<float> x{0.0f, 800.0f};
+        std::uniform_real_distribution<float> y{0.0f, 600.0f};
+        std::uniform_real_distribution<float> angle{0.0f, 6.2831853f};
+        std::uniform_real_distribution<float> lifetime{0.5f, ShootingSystem::BULLET_LIFETIME};
+
+        template <typename Spawn>
+        void next(Spawn &&spawn)
+        {
+            float radians = angle(rng);
+            spawn(x(rng), y(rng), std::cos(radians) * ShootingSystem::BULLET_SPEED,
+                  std::sin(radians) * ShootingSystem::BULLET_SPEED, lifetime(rng));
+        }
+    };
+
+    // ShootingSystem's per-tick pool update on its own: size() live bullets
+    // crossing the 800x600 arena, with the ones that leave or expire
+    // replaced before every tick. Same seed for both layouts, so they
+    // integrate and drop the same bullets.
+    void projectileIntegration(BenchmarkContext &ctx)
+    {
+        const float minX = -ShootingSystem::BULLET_MARGIN;
+        const float minY = -ShootingSystem::BULLET_MARGIN;
+        const float maxX = 800.0f + ShootingSystem::BULLET_MARGIN;
+        const float maxY = 600.0f + ShootingSystem::BULLET_MARGIN;
+
+        {
+            Spawner spawner;
+            std::vector<AosProjectile> projectiles;
+            projectiles.reserve(ctx.size());
+            ctx.measure("aos_branchy/tick", ctx.size() * TICKS_PER_RUN, [&]()
+                        {
+                            for (int tick = 0; tick < TICKS_PER_RUN; ++tick)
+                            {
+                                while (projectiles.size() < ctx.size())
+                                {
+                                    spawner.next([&](float x, float y, float vx, float vy, float lifetime)
+                                                 {
+                                                     projectiles.push_back({x, y, x, y, vx, vy, 0.0f, lifetime});
+                                                 });
+                                }
+                                integrateAos(projectiles, TICK_DT, minX, minY, maxX, maxY);
+                            }
+                        });
+        }
+
+        {
+            Spawner spawner;
+            ProjectilePool pool(ctx.size());
+            ctx.measure("soa_fused/tick", ctx.size() * TICKS_PER_RUN, [&]()
+                        {
+                            for (int tick = 0; tick < TICKS_PER_RUN; ++tick)
+                            {
+                                while (pool.size() < ctx.size())
+                                {
+                                    spawner.next([&](float x, float y, float vx, float vy, float lifetime)
+                                                 {
+                                                     pool.spawn(x, y, vx, vy, lifetime);
+                                                 });
+                                }
+                                pool.integrate(TICK_DT, minX, minY, maxX, maxY);
+                            }
+                        });
+        }
+    }
+
+    // One ring volley of size() body bullets: a spawnProjectile() call per
+    // bullet against one spawnProjectiles() call that reserves handles and
+    // component slots for the whole batch. Each run destroys the volley
+    // afterwards so both start from the same pools.
+    void volleySpawn(BenchmarkContext &ctx)
+    {
+        Manager manager;
+        Events events;
+        ShootingSystem shooting{&manager};
+        shooting.setEvents(&events);
+
+        std::vector<float> angles(ctx.size());
+        for (std::size_t i = 0; i < angles.size(); ++i)
+        {
+            angles[i] = 360.0f * static_cast<float>(i) / static_cast<float>(angles.size());
+        }
+
+        auto reset = [&]()
+        {
+            manager.destroyEntities(manager.getAllEntities());
+            events.clear();
+        };
+
+        ctx.measure("per_bullet", ctx.size(), [&]()
+                    {
+                        for (float angle : angles)
+                            shooting.spawnProjectile(400.0f, 300.0f, angle, ProjectileMode::Body);
+                        reset();
+                    });
+
+        ctx.measure("bulk", ctx.size(), [&]()
+                    {
+                        shooting.spawnProjectiles(400.0f, 300.0f, angles.data(), angles.size(),
+                                                  ShootingSystem::BULLET_SPEED, ShootingSystem::BULLET_LIFETIME,
+                                                  ProjectileMode::Body);
+                        reset();
+                    });
+    }
+}
+
+REGISTER_BENCHMARK("gameplay/volley_spawn", (std::vector<std::size_t>{100, 1000}), volleySpawn);
+REGISTER_BENCHMARK("gameplay/projectile_integrate", (std::vector<std::size_t>{10000, 100000}), projectileIntegration);
+REGISTER_BENCHMARK("gameplay/projectiles", (std::vector<std::size_t>{1000, 10000}), projectileModes);
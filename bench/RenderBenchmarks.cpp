@@ -0,0 +1,116 @@
+#include "Benchmark.hpp"
+#include "../src/core/Components.hpp"
+#include "../src/core/Manager.hpp"
+#include "../src/gameplay/ProjectilePool.hpp"
+#include "../src/rendering/HUDSystem.hpp"
+#include "../src/rendering/Renderer.hpp"
+#include "../src/rendering/TextLayer.hpp"
+#include <SDL3/SDL.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr int TARGET_WIDTH = 800;
+    constexpr int TARGET_HEIGHT = 600;
+
+    // SDL's software renderer drawing into a plain surface: needs no video
+    // subsystem or window, so it runs on headless machines. Absolute numbers
+    // are CPU rasterization costs, not GPU ones, but the per-call overhead and
+    // relative changes in the submission code still show up.
+    struct OffscreenTarget
+    {
+        SDL_Surface *surface = SDL_CreateSurface(TARGET_WIDTH, TARGET_HEIGHT, SDL_PIXELFORMAT_RGBA8888);
+        SDL_Renderer *renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+
+        ~OffscreenTarget()
+        {
+            if (renderer)
+                SDL_DestroyRenderer(renderer);
+            if (surface)
+                SDL_DestroySurface(surface);
+        }
+    };
+
+    // Renderer::renderAllEntities over size() 24x24 obstacles with render
+    // interpolation, plus renderProjectiles over the same number of
+    // ray-cast bullets for comparison with the batched path
+    void rendererDraw(BenchmarkContext &ctx)
+    {
+        OffscreenTarget target;
+        if (!target.renderer)
+            return;
+        Renderer renderer(target.renderer);
+
+        Manager manager;
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> x(0.0f, TARGET_WIDTH - 24.0f);
+        std::uniform_real_distribution<float> y(0.0f, TARGET_HEIGHT - 24.0f);
+
+        std::vector<Entity> entities;
+        manager.createEntities(ctx.size(), entities);
+        for (Entity entity : entities)
+        {
+            float px = x(rng);
+            float py = y(rng);
+            addComponent<Position>(entity, {px, py});
+            addComponent<PreviousPosition>(entity, {px - 1.0f, py - 1.0f});
+            addComponent<Renderable>(entity, {"red", 24, 24, false});
+        }
+
+        ctx.measure("render_all_entities", ctx.size(), [&]()
+                    {
+                        renderer.renderAllEntities(0.5f);
+                    });
+        manager.destroyEntities(manager.getAllEntities());
+
+        ProjectilePool pool(ctx.size());
+        for (std::size_t i = 0; i < ctx.size(); ++i)
+        {
+            pool.spawn(x(rng), y(rng), 100.0f, 0.0f, 3.0f);
+        }
+        ctx.measure("render_projectiles", ctx.size(), [&]()
+                    {
+                        renderer.renderProjectiles(pool, 0.5f);
+                    });
+    }
+
+    // A line of size() characters. "render_text" is HUDSystem::renderText,
+    // which draws from the glyph atlas with one SDL_RenderGeometry call;
+    // "cached_layer" is how the HUD draws its lines: the unchanged text is
+    // set again every run and only the layer's texture is blitted.
+    void hudText(BenchmarkContext &ctx)
+    {
+        OffscreenTarget target;
+        if (!target.renderer)
+            return;
+        HUDSystem hud(target.renderer);
+
+        const std::string alphabet = "FPS: 0123456789.";
+        std::string text;
+        for (std::size_t i = 0; i < ctx.size(); ++i)
+        {
+            text += alphabet[i % alphabet.size()];
+        }
+        const SDL_Color color = {255, 255, 255, 255};
+
+        ctx.measure("render_text", ctx.size(), [&]()
+                    {
+                        hud.renderText(text, 10, 10, color);
+                        hud.flushText();
+                    });
+
+        GlyphAtlas atlas(target.renderer);
+        TextBatch batch(&atlas);
+        TextLayer layer;
+        ctx.measure("cached_layer", ctx.size(), [&]()
+                    {
+                        layer.setText(text.c_str(), color);
+                        layer.render(target.renderer, batch, 10.0f, 10.0f);
+                    });
+    }
+}
+
+REGISTER_BENCHMARK("rendering/renderer", (std::vector<std::size_t>{1000, 10000}), rendererDraw);
+REGISTER_BENCHMARK("rendering/hud_text", (std::vector<std::size_t>{16, 64}), hudText);
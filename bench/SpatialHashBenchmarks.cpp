@@ -0,0 +1,189 @@
+#include "Benchmark.hpp"
+#include "../src/core/Manager.hpp"
+#include "../src/physics/PhysicsSystem.hpp"
+#include "../src/physics/SpatialHash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Obstacles are spread at constant density (one per 80x80 px on average),
+    // so a growing count means a growing map, as it would in the game
+    constexpr float AREA_PER_OBSTACLE = 80.0f * 80.0f;
+    constexpr std::size_t QUERY_COUNT = 1000;
+
+    struct Obstacle
+    {
+        Entity entity;
+        Aabb box;
+    };
+
+    std::vector<Obstacle> makeObstacles(std::size_t count, float worldSize)
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> position(0.0f, worldSize);
+        std::uniform_real_distribution<float> extent(10.0f, 40.0f);
+
+        std::vector<Obstacle> obstacles(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float x = position(rng);
+            float y = position(rng);
+            float halfWidth = extent(rng);
+            float halfHeight = extent(rng);
+            obstacles[i] = {static_cast<Entity>(i + 1), {x - halfWidth, y - halfHeight, x + halfWidth, y + halfHeight}};
+        }
+        return obstacles;
+    }
+
+    void spatialQueries(BenchmarkContext &ctx)
+    {
+        const float worldSize = std::sqrt(ctx.size() * AREA_PER_OBSTACLE);
+        std::vector<Obstacle> obstacles = makeObstacles(ctx.size(), worldSize);
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(0.0f, worldSize);
+        std::vector<Aabb> queries(QUERY_COUNT);
+        for (Aabb &query : queries)
+        {
+            float x = position(rng);
+            float y = position(rng);
+            query = {x - 32.0f, y - 32.0f, x + 32.0f, y + 32.0f}; // Player-sized neighbourhood
+        }
+
+        SpatialHash hash(64.0f);
+        for (const Obstacle &obstacle : obstacles)
+        {
+            hash.insert(obstacle.entity, obstacle.box);
+        }
+
+        std::vector<Entity> results;
+        results.reserve(256);
+
+        // Baseline: the linear scan the collision code used to do
+        ctx.measure("linear/query_aabb", queries.size(), [&]()
+                    {
+                        std::size_t found = 0;
+                        for (const Aabb &query : queries)
+                            for (const Obstacle &obstacle : obstacles)
+                                found += obstacle.box.overlaps(query);
+                        doNotOptimize(found);
+                    });
+
+        ctx.measure("hash/query_aabb", queries.size(), [&]()
+                    {
+                        std::size_t found = 0;
+                        for (const Aabb &query : queries)
+                        {
+                            results.clear();
+                            hash.queryAabb(query, results);
+                            found += results.size();
+                        }
+                        doNotOptimize(found);
+                    });
+
+        ctx.measure("hash/query_point", queries.size(), [&]()
+                    {
+                        std::size_t found = 0;
+                        for (const Aabb &query : queries)
+                        {
+                            results.clear();
+                            hash.queryPoint(query.minX + 32.0f, query.minY + 32.0f, results);
+                            found += results.size();
+                        }
+                        doNotOptimize(found);
+                    });
+
+        // Per-frame incremental update: every obstacle drifts a couple of pixels
+        float drift = 2.0f;
+        ctx.measure("hash/update_all", obstacles.size(), [&]()
+                    {
+                        drift = -drift;
+                        for (Obstacle &obstacle : obstacles)
+                        {
+                            obstacle.box.minX += drift;
+                            obstacle.box.maxX += drift;
+                            hash.update(obstacle.entity, obstacle.box);
+                        }
+                    });
+    }
+
+    // PhysicsSystem's own queries over map-style obstacles (Position is the
+    // top-left corner). Before timing, every obstacle is checked to be found
+    // exactly under its rendered rectangle; a mismatch fails the run.
+    void proximityQueries(BenchmarkContext &ctx)
+    {
+        constexpr float SIZE = 40.0f;
+        constexpr float GAP = 40.0f; // Keeps probes just outside one obstacle clear of its neighbours
+        const std::size_t perRow = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(ctx.size()))));
+
+        Manager manager;
+        PhysicsSystem physics(&manager);
+        physics.setSpatialCellSize(64.0f);
+
+        std::vector<Entity> obstacles;
+        for (std::size_t i = 0; i < ctx.size(); ++i)
+        {
+            Entity entity = manager.createEntity();
+            addComponent(entity, Position{(i % perRow) * (SIZE + GAP), (i / perRow) * (SIZE + GAP)});
+            addComponent(entity, Velocity{0.0f, 0.0f});
+            addComponent(entity, Renderable{"obstacle", static_cast<int>(SIZE), static_cast<int>(SIZE)});
+            addComponent(entity, PhysicsBody{BodyType::Static});
+            physics.addEntity(entity);
+            obstacles.push_back(entity);
+        }
+
+        std::vector<Entity> results;
+        auto finds = [&](float x, float y, Entity entity)
+        {
+            results.clear();
+            physics.queryPoint(x, y, results);
+            return std::find(results.begin(), results.end(), entity) != results.end();
+        };
+        for (Entity entity : obstacles)
+        {
+            const Position &pos = *getComponent<Position>(entity);
+            bool inside = finds(pos.x + 1.0f, pos.y + 1.0f, entity) && finds(pos.x + SIZE - 1.0f, pos.y + SIZE - 1.0f, entity);
+            bool outside = finds(pos.x - 1.0f, pos.y - 1.0f, entity) || finds(pos.x + SIZE + 1.0f, pos.y + SIZE + 1.0f, entity);
+            if (!inside || outside)
+            {
+                std::fprintf(stderr, "physics/proximity_query: entity %u at (%.0f, %.0f) is not indexed under its rendered rectangle\n",
+                             entity, pos.x, pos.y);
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        const float worldSize = perRow * (SIZE + GAP);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(0.0f, worldSize);
+        std::vector<Aabb> queries(QUERY_COUNT);
+        for (Aabb &query : queries)
+        {
+            float x = position(rng);
+            float y = position(rng);
+            query = {x - 32.0f, y - 32.0f, x + 32.0f, y + 32.0f};
+        }
+
+        ctx.measure("query_area", queries.size(), [&]()
+                    {
+                        std::size_t found = 0;
+                        for (const Aabb &query : queries)
+                        {
+                            results.clear();
+                            physics.queryArea(query, results);
+                            found += results.size();
+                        }
+                        doNotOptimize(found);
+                    });
+
+        // Component pools are global; leave them empty for the next benchmark
+        manager.destroyEntities(manager.getAllEntities());
+    }
+}
+
+REGISTER_BENCHMARK("physics/spatial_hash", (std::vector<std::size_t>{1000, 5000, 10000, 50000}), spatialQueries);
+REGISTER_BENCHMARK("physics/proximity_query", (std::vector<std::size_t>{1000, 10000}), proximityQueries);
@@ -0,0 +1,143 @@
+#include "Benchmark.hpp"
+#include "../src/core/CommandBuffer.hpp"
+#include "../src/core/Components.hpp"
+#include "../src/core/Events.hpp"
+#include "../src/core/Manager.hpp"
+#include "../src/gameplay/ProjectilePool.hpp"
+#include "../src/gameplay/ShootingSystem.hpp"
+#include "../src/physics/PhysicsSystem.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr float TICK_DT = 1.0f / 60.0f;
+    constexpr int TICKS_PER_RUN = 30;
+
+    // ShootingSystem::update with size() live bullets and no shooting. The
+    // bullets never expire (entity bullets are not moved here, that is
+    // Box2D's job; ray-cast ones crawl a few pixels per second), so every
+    // run sees the same count and measures the per-bullet update alone.
+    void shootingUpdate(BenchmarkContext &ctx)
+    {
+        Manager manager;
+        CommandBuffer commands(&manager);
+        Events events;
+        ProjectilePool pool(ctx.size());
+        ShootingSystem shooting(&manager);
+        shooting.setEvents(&events);
+        shooting.setCommandBuffer(&commands);
+        shooting.setProjectilePool(&pool);
+
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> x(100.0f, 700.0f);
+        std::uniform_real_distribution<float> y(100.0f, 500.0f);
+        std::uniform_real_distribution<float> crawl(-2.0f, 2.0f);
+
+        std::vector<Entity> bullets;
+        manager.createEntities(ctx.size(), bullets);
+        for (Entity bullet : bullets)
+        {
+            float px = x(rng);
+            float py = y(rng);
+            addComponent<Position>(bullet, {px, py});
+            addComponent<PreviousPosition>(bullet, {px, py});
+            addComponent<Velocity>(bullet, {crawl(rng), crawl(rng)});
+            addComponent<Bullet>(bullet, {ShootingSystem::BULLET_SPEED, 1e9f, 0.0f});
+            addComponent<Renderable>(bullet, {"yellow", 4, 4, false});
+        }
+
+        ctx.measure("update/body_bullets", ctx.size() * TICKS_PER_RUN, [&]()
+                    {
+                        for (int tick = 0; tick < TICKS_PER_RUN; ++tick)
+                        {
+                            shooting.update(TICK_DT);
+                            events.clear();
+                        }
+                    });
+        manager.destroyEntities(manager.getAllEntities());
+
+        for (std::size_t i = 0; i < ctx.size(); ++i)
+        {
+            pool.spawn(x(rng), y(rng), crawl(rng), crawl(rng), 1e9f);
+        }
+        ctx.measure("update/ray_bullets", ctx.size() * TICKS_PER_RUN, [&]()
+                    {
+                        for (int tick = 0; tick < TICKS_PER_RUN; ++tick)
+                        {
+                            shooting.update(TICK_DT);
+                            events.clear();
+                        }
+                    });
+    }
+
+    // PhysicsSystem::update (sync in, step, sync out, events) with size()
+    // dynamic obstacles on a grid inside a walled arena. "moving" kicks
+    // every obstacle with a new velocity before each run, the way heavy
+    // fire does; "resting" steps the same scene once everything has fallen
+    // asleep, which is what an idle map costs.
+    void physicsUpdate(BenchmarkContext &ctx)
+    {
+        Manager manager;
+        CommandBuffer commands(&manager);
+        Events events;
+        PhysicsSystem physics(&manager);
+        physics.setEvents(&events);
+        physics.setCommandBuffer(&commands);
+
+        constexpr float SPACING = 40.0f;
+        const int perRow = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(ctx.size()))));
+        const float arena = perRow * SPACING;
+        physics.setWorldBounds(arena, arena);
+
+        std::vector<Entity> obstacles;
+        manager.createEntities(ctx.size(), obstacles);
+        for (std::size_t i = 0; i < obstacles.size(); ++i)
+        {
+            Entity obstacle = obstacles[i];
+            float px = (static_cast<int>(i % perRow) + 0.5f) * SPACING;
+            float py = (static_cast<int>(i / perRow) + 0.5f) * SPACING;
+            addComponent<Position>(obstacle, {px, py});
+            addComponent<Velocity>(obstacle, {0.0f, 0.0f});
+            addComponent<Renderable>(obstacle, {"red", 24, 24, false});
+            physics.addEntity(obstacle);
+        }
+
+        auto step = [&](int ticks)
+        {
+            for (int tick = 0; tick < ticks; ++tick)
+            {
+                physics.update(TICK_DT);
+                commands.flush();
+                events.clear();
+            }
+        };
+
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> kick(-60.0f, 60.0f);
+        ctx.measure("update/moving", TICKS_PER_RUN, [&]()
+                    {
+                        for (Entity obstacle : obstacles)
+                        {
+                            Velocity *vel = getComponent<Velocity>(obstacle);
+                            vel->x = kick(rng);
+                            vel->y = kick(rng);
+                            events.physicsDirty.push({obstacle});
+                        }
+                        step(TICKS_PER_RUN);
+                    });
+
+        // Let the kicks die down; Box2D puts a body to sleep after half a second at rest
+        step(600);
+        ctx.measure("update/resting", TICKS_PER_RUN, [&]()
+                    {
+                        step(TICKS_PER_RUN);
+                    });
+
+        manager.destroyEntities(manager.getAllEntities());
+    }
+}
+
+REGISTER_BENCHMARK("systems/shooting_update", (std::vector<std::size_t>{1000, 10000, 100000}), shootingUpdate);
+REGISTER_BENCHMARK("systems/physics_update", (std::vector<std::size_t>{100, 1000, 5000}), physicsUpdate);
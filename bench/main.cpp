@@ -0,0 +1,92 @@
+#include "Benchmark.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <string>
+
+std::vector<BenchmarkDefinition> &getBenchmarkRegistry()
+{
+  static std::vector<BenchmarkDefinition> registry;
+  return registry;
+}
+
+// Usage: ./Benchmarks [filter] [--reps N] [--json FILE]
+int main(int argc, char **argv)
+{
+  std::string filter;
+  std::string jsonPath;
+  int repetitions = 5;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+    {
+      repetitions = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+    {
+      jsonPath = argv[++i];
+    }
+    else
+    {
+      filter = argv[i];
+    }
+  }
+
+  // Every result also goes into a JSON document so runs can be saved and diffed
+  nlohmann::json results = nlohmann::json::array();
+
+  std::printf("%-24s %-28s %10s %14s %16s\n", "benchmark", "case", "size", "ns/op", "ops/s");
+  for (const auto &definition : getBenchmarkRegistry())
+  {
+    if (!filter.empty() && definition.name.find(filter) == std::string::npos)
+      continue;
+
+    for (std::size_t size : definition.sizes)
+    {
+      BenchmarkContext context(definition.name, size, repetitions);
+      definition.function(context);
+
+      for (const auto &result : context.getResults())
+      {
+        std::printf("%-24s %-28s %10zu %14.2f %16.0f\n",
+                    result.benchmark.c_str(), result.label.c_str(), result.size,
+                    result.nsPerOp, result.opsPerSecond);
+        results.push_back({{"benchmark", result.benchmark},
+                           {"case", result.label},
+                           {"size", result.size},
+                           {"ns_per_op", result.nsPerOp},
+                           {"ops_per_second", result.opsPerSecond}});
+      }
+    }
+  }
+
+  if (!jsonPath.empty())
+  {
+    // An empty report is never worth diffing; most likely the filter matched nothing
+    if (results.empty())
+    {
+      std::fprintf(stderr, "No benchmark results to write to %s\n", jsonPath.c_str());
+      return 1;
+    }
+
+    std::ofstream out(jsonPath, std::ios::trunc);
+    if (!out.is_open())
+    {
+      std::fprintf(stderr, "Failed to open %s for writing\n", jsonPath.c_str());
+      return 1;
+    }
+    nlohmann::json report = {{"repetitions", repetitions}, {"filter", filter}, {"results", results}};
+    out << report.dump(2) << '\n';
+    if (!out.good())
+    {
+      std::fprintf(stderr, "Failed to write %s\n", jsonPath.c_str());
+      return 1;
+    }
+    std::printf("Wrote %zu results to %s\n", results.size(), jsonPath.c_str());
+  }
+
+  return 0;
+}
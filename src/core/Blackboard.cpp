@@ -1,39 +1,31 @@
 #include "Blackboard.hpp"
-#include <iostream>
+#include "Log.hpp"
+#include <mutex>
+#include <unordered_map>
 
-void Blackboard::set(const std::string &key, const std::any &value)
+std::size_t internBlackboardKey(const std::string &name)
 {
-  data[key] = value;
-  std::cout << "[Blackboard] Set key: " << key << std::endl;
-}
+  static std::mutex internMutex;
+  static std::unordered_map<std::string, std::size_t> internedKeys;
 
-std::any Blackboard::get(const std::string &key) const
-{
-  auto it = data.find(key);
-  if (it != data.end())
+  std::lock_guard<std::mutex> lock(internMutex);
+  auto it = internedKeys.find(name);
+  if (it != internedKeys.end())
   {
     return it->second;
   }
-  return std::any{}; // Return empty any if key not found
-}
 
-bool Blackboard::has(const std::string &key) const
-{
-  return data.find(key) != data.end();
+  std::size_t id = internedKeys.size();
+  internedKeys.emplace(name, id);
+  return id;
 }
 
 void Blackboard::clear()
 {
-  data.clear();
-  std::cout << "[Blackboard] Cleared all data" << std::endl;
-}
-
-void Blackboard::remove(const std::string &key)
-{
-  auto it = data.find(key);
-  if (it != data.end())
+  for (auto &slot : slots)
   {
-    data.erase(it);
-    std::cout << "[Blackboard] Removed key: " << key << std::endl;
+    if (slot)
+      slot->present = false;
   }
+  LOG_DEBUG(Blackboard, "Cleared all data");
 }
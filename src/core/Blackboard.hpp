@@ -1,48 +1,141 @@
 #pragma once
-#include <any>
+#include <cstddef>
+#include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 /**
- * @brief Blackboard system for inter-system communication.
- * @note Requires C++17 for std::any.
+ * @brief Interns a blackboard key name and returns its dense id. The same
+ * name always maps to the same id for the lifetime of the process.
+ */
+std::size_t internBlackboardKey(const std::string &name);
+
+/**
+ * @brief Typed handle to a blackboard slot. Resolve it once (see
+ * BlackboardKeys.hpp) and reuse it; the handle is just an index, so using it
+ * involves no string construction and no hashing.
+ */
+template <typename T>
+struct BlackboardKey
+{
+  explicit BlackboardKey(const std::string &name) : id(internBlackboardKey(name)) {}
+
+  std::size_t id;
+};
+
+/**
+ * @brief Blackboard for state shared between systems.
+ *
+ * Values live in typed slots indexed by interned key id, so reads and writes
+ * through a BlackboardKey are an array index plus a type check: no boxing,
+ * no hashing and no heap traffic after the slot exists. declare() creates a
+ * slot up front so even the first write does not allocate.
  */
 class Blackboard
 {
 public:
-  void set(const std::string &key, const std::any &value);
-  std::any get(const std::string &key) const;
-  bool has(const std::string &key) const;
-  void clear();
-  void remove(const std::string &key);
+  template <typename T>
+  void declare(BlackboardKey<T> key, const T &initialValue = T{})
+  {
+    if (Slot<T> *slot = createSlot<T>(key.id))
+    {
+      slot->value = initialValue;
+    }
+  }
 
-  // Template helper for type-safe access
   template <typename T>
-  T getValue(const std::string &key) const
+  void set(BlackboardKey<T> key, const T &value)
   {
-    auto it = data.find(key);
-    if (it != data.end())
+    if (Slot<T> *slot = createSlot<T>(key.id))
     {
-      try
-      {
-        return std::any_cast<T>(it->second);
-      }
-      catch (const std::bad_any_cast &e)
-      {
-        // Return default value if cast fails
-        return T{};
-      }
+      slot->value = value;
+      slot->present = true;
     }
-    return T{};
   }
 
-  // Template helper for type-safe setting
+  // Pointer to the stored value, or nullptr if unset (or stored as another type)
   template <typename T>
-  void setValue(const std::string &key, const T &value)
+  const T *find(BlackboardKey<T> key) const
   {
-    set(key, std::any(value));
+    const Slot<T> *slot = findSlot<T>(key.id);
+    return (slot && slot->present) ? &slot->value : nullptr;
   }
 
+  // Stored value, or a default-constructed T if unset
+  template <typename T>
+  T get(BlackboardKey<T> key) const
+  {
+    const T *value = find(key);
+    return value ? *value : T{};
+  }
+
+  template <typename T>
+  bool has(BlackboardKey<T> key) const { return find(key) != nullptr; }
+
+  template <typename T>
+  void remove(BlackboardKey<T> key)
+  {
+    if (const Slot<T> *slot = findSlot<T>(key.id))
+    {
+      const_cast<Slot<T> *>(slot)->present = false;
+    }
+  }
+
+  void clear();
+
+  // String-keyed convenience for tools and debugging. Each call interns the
+  // name (a hash lookup), so hot paths should hold a BlackboardKey instead.
+  template <typename T>
+  T getValue(const std::string &key) const { return get(BlackboardKey<T>(key)); }
+
+  template <typename T>
+  void setValue(const std::string &key, const T &value) { set(BlackboardKey<T>(key), value); }
+
 private:
-  std::unordered_map<std::string, std::any> data;
-};
\ No newline at end of file
+  struct SlotBase
+  {
+    explicit SlotBase(const void *type) : type(type) {}
+    virtual ~SlotBase() = default;
+    const void *type; // Tag of the stored type, see typeTag()
+    bool present = false;
+  };
+
+  template <typename T>
+  struct Slot : SlotBase
+  {
+    Slot() : SlotBase(typeTag<T>()) {}
+    T value{};
+  };
+
+  std::vector<std::unique_ptr<SlotBase>> slots; // Indexed by interned key id
+
+  template <typename T>
+  static const void *typeTag()
+  {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  template <typename T>
+  const Slot<T> *findSlot(std::size_t id) const
+  {
+    // A key used with two different types finds nothing for the second type
+    if (id >= slots.size() || !slots[id] || slots[id]->type != typeTag<T>())
+      return nullptr;
+    return static_cast<const Slot<T> *>(slots[id].get());
+  }
+
+  template <typename T>
+  Slot<T> *createSlot(std::size_t id)
+  {
+    if (id >= slots.size())
+    {
+      slots.resize(id + 1);
+    }
+    if (!slots[id])
+    {
+      slots[id] = std::make_unique<Slot<T>>();
+    }
+    return const_cast<Slot<T> *>(findSlot<T>(id));
+  }
+};
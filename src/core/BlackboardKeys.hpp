@@ -0,0 +1,13 @@
+#pragma once
+#include "Blackboard.hpp"
+
+/**
+ * @brief Well-known blackboard keys, interned once at startup.
+ */
+namespace BlackboardKeys
+{
+  inline const BlackboardKey<bool> HUD_TOGGLE_REQUEST{"hud_toggle_request"};
+  inline const BlackboardKey<bool> EXIT_GAME_REQUEST{"exit_game_request"};
+  inline const BlackboardKey<bool> PROFILER_OVERLAY_REQUEST{"profiler_overlay_request"};
+  inline const BlackboardKey<bool> PROFILER_DUMP_REQUEST{"profiler_dump_request"};
+}
@@ -0,0 +1,36 @@
+#include "CommandBuffer.hpp"
+#include <algorithm>
+
+CommandBuffer::CommandBuffer(Manager *mgr) : manager(mgr) {}
+
+Entity CommandBuffer::createEntity()
+{
+  return manager->createEntity();
+}
+
+void CommandBuffer::destroyEntity(Entity entity)
+{
+  pendingDestroy.push_back(entity);
+}
+
+void CommandBuffer::flush()
+{
+  for (ICommandQueue *queue : queueOrder)
+  {
+    queue->apply(*manager);
+  }
+
+  // Several systems may have asked for the same entity (e.g. a bullet that
+  // expired and hit something in the same tick); destroy each one once
+  std::sort(pendingDestroy.begin(), pendingDestroy.end());
+  pendingDestroy.erase(std::unique(pendingDestroy.begin(), pendingDestroy.end()), pendingDestroy.end());
+  pendingDestroy.erase(std::remove_if(pendingDestroy.begin(), pendingDestroy.end(),
+                                      [&](Entity entity)
+                                      { return !manager->isAlive(entity); }),
+                       pendingDestroy.end());
+
+  manager->destroyEntities(pendingDestroy);
+
+  destroyedEntities.swap(pendingDestroy);
+  pendingDestroy.clear();
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Manager.hpp"
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Records structural ECS changes so they can be applied at a single
+ * sync point at the end of the tick (GameEngine::update).
+ *
+ * Systems record while iterating views without invalidating the pools they
+ * walk. On flush(), component adds/removes are applied per type in record
+ * order, then all destroys are applied as one batch. createEntity() hands out
+ * the handle immediately (allocating a handle does not touch any pool), but
+ * components recorded for it only appear after the flush. Component ops for
+ * an entity that is no longer alive when they are applied are dropped.
+ */
+class CommandBuffer
+{
+public:
+  explicit CommandBuffer(Manager *manager);
+
+  Entity createEntity();
+  void destroyEntity(Entity entity);
+
+  template <typename T>
+  void addComponent(Entity entity, const T &component)
+  {
+    getQueue<T>().ops.push_back({entity, false, component});
+  }
+
+  template <typename T>
+  void removeComponent(Entity entity)
+  {
+    getQueue<T>().ops.push_back({entity, true, T{}});
+  }
+
+  /**
+   * @brief Apply every recorded command. Entities destroyed by this flush are
+   * available from getDestroyedEntities() until the next flush.
+   */
+  void flush();
+
+  // Sorted, de-duplicated list of entities destroyed by the last flush
+  const std::vector<Entity> &getDestroyedEntities() const { return destroyedEntities; }
+
+private:
+  struct ICommandQueue
+  {
+    virtual ~ICommandQueue() = default;
+    virtual void apply(const Manager &manager) = 0;
+  };
+
+  template <typename T>
+  struct CommandQueue : ICommandQueue
+  {
+    struct Op
+    {
+      Entity entity;
+      bool remove;
+      T component;
+    };
+    std::vector<Op> ops;
+
+    void apply(const Manager &manager) override
+    {
+      for (Op &op : ops)
+      {
+        // The entity may have been destroyed since the op was recorded
+        if (!manager.isAlive(op.entity))
+          continue;
+        if (op.remove)
+          ::removeComponent<T>(op.entity);
+        else
+          ::addComponent<T>(op.entity, op.component);
+      }
+      ops.clear(); // Keeps capacity, so steady-state recording does not allocate
+    }
+  };
+
+  Manager *manager;
+  std::vector<std::unique_ptr<ICommandQueue>> queues; // Indexed by componentTypeId
+  std::vector<ICommandQueue *> queueOrder;             // Flush order: first-use order of each type
+  std::vector<Entity> pendingDestroy;
+  std::vector<Entity> destroyedEntities;
+
+  template <typename T>
+  CommandQueue<T> &getQueue()
+  {
+    ComponentTypeId id = componentTypeId<T>();
+    if (queues.size() <= id)
+    {
+      queues.resize(id + 1);
+    }
+    std::unique_ptr<ICommandQueue> &queue = queues[id];
+    if (!queue)
+    {
+      queue = std::make_unique<CommandQueue<T>>();
+      queueOrder.push_back(queue.get());
+    }
+    return static_cast<CommandQueue<T> &>(*queue);
+  }
+};
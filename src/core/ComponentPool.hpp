@@ -0,0 +1,166 @@
+#pragma once
+#include "Entity.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Whether the handle's version is the current one for its index in the
+ * live Manager (see Manager.cpp). True for any handle when no Manager exists,
+ * so pools can also be used on their own.
+ */
+bool isCurrentEntity(Entity entity);
+
+/**
+ * @brief Type-erased view of a component pool so the Manager can strip an
+ * entity from every pool without knowing the component types.
+ */
+class IComponentPool
+{
+public:
+  virtual ~IComponentPool() = default;
+  virtual bool has(Entity entity) const = 0;
+  virtual void remove(Entity entity) = 0;
+  virtual std::size_t size() const = 0;
+  virtual void clear() = 0;
+};
+
+/**
+ * @brief Sparse-set storage for a single component type.
+ *
+ * Components are kept in a packed dense array, so iterating every component
+ * of a type is a linear scan. A paged sparse array maps an entity's slot
+ * index to its dense slot, so lookups are plain array indexing; the full
+ * handle stored densely is compared on lookup, so a stale (recycled) handle
+ * finds nothing. Removal swaps the last element into the hole, which means
+ * dense order is not stable and pointers returned by get() are only valid
+ * until the next add/remove on this pool.
+ */
+template <typename T>
+class ComponentPool : public IComponentPool
+{
+public:
+  /**
+   * @brief Add or replace the component. Returns nullptr if the handle is
+   * stale: destroyed, or its slot is owned by a newer version of the entity.
+   * Refusing destroyed handles matters even when the slot is free, since a
+   * component stored for one would block the index's next owner.
+   */
+  T *add(Entity entity, const T &component)
+  {
+    if (!isCurrentEntity(entity))
+      return nullptr;
+
+    std::uint32_t &slot = sparseSlot(entity);
+    if (slot != INVALID_SLOT)
+    {
+      if (denseEntities[slot] != entity)
+        return nullptr;
+      denseComponents[slot] = component;
+      return &denseComponents[slot];
+    }
+
+    slot = static_cast<std::uint32_t>(denseEntities.size());
+    denseEntities.push_back(entity);
+    denseComponents.push_back(component);
+    return &denseComponents.back();
+  }
+
+  T *get(Entity entity)
+  {
+    std::uint32_t slot = findSlot(entity);
+    return slot != INVALID_SLOT ? &denseComponents[slot] : nullptr;
+  }
+
+  bool has(Entity entity) const override
+  {
+    return findSlot(entity) != INVALID_SLOT;
+  }
+
+  void remove(Entity entity) override
+  {
+    std::uint32_t slot = findSlot(entity);
+    if (slot == INVALID_SLOT)
+      return;
+
+    // Swap the last element into the freed slot to keep the arrays packed
+    std::uint32_t last = static_cast<std::uint32_t>(denseEntities.size() - 1);
+    if (slot != last)
+    {
+      Entity moved = denseEntities[last];
+      denseEntities[slot] = moved;
+      denseComponents[slot] = std::move(denseComponents[last]);
+      sparseSlot(moved) = slot;
+    }
+
+    denseEntities.pop_back();
+    denseComponents.pop_back();
+    sparseSlot(entity) = INVALID_SLOT;
+  }
+
+  std::size_t size() const override { return denseEntities.size(); }
+
+  /**
+   * @brief Make room for `additional` more components so a batch of adds does
+   * not reallocate part-way through. Grows geometrically, so reserving for
+   * many small batches stays amortized O(1) per add.
+   */
+  void reserveFor(std::size_t additional)
+  {
+    std::size_t needed = denseEntities.size() + additional;
+    if (needed <= denseEntities.capacity())
+      return;
+    std::size_t capacity = std::max(needed, denseEntities.capacity() * 2);
+    denseEntities.reserve(capacity);
+    denseComponents.reserve(capacity);
+  }
+
+  void clear() override
+  {
+    denseEntities.clear();
+    denseComponents.clear();
+    sparsePages.clear();
+  }
+
+  // Packed arrays, index-aligned: entities()[i] owns components()[i]
+  const std::vector<Entity> &entities() const { return denseEntities; }
+  std::vector<T> &components() { return denseComponents; }
+
+private:
+  static constexpr std::uint32_t PAGE_SIZE = 4096;
+  static constexpr std::uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+  // Sparse array is paged so a large entity id does not force a huge allocation
+  std::vector<std::unique_ptr<std::uint32_t[]>> sparsePages;
+  std::vector<Entity> denseEntities;
+  std::vector<T> denseComponents;
+
+  std::uint32_t findSlot(Entity entity) const
+  {
+    std::uint32_t index = entityIndex(entity);
+    std::size_t page = index / PAGE_SIZE;
+    if (page >= sparsePages.size() || !sparsePages[page])
+      return INVALID_SLOT;
+
+    std::uint32_t slot = sparsePages[page][index % PAGE_SIZE];
+    if (slot == INVALID_SLOT || denseEntities[slot] != entity)
+      return INVALID_SLOT;
+    return slot;
+  }
+
+  std::uint32_t &sparseSlot(Entity entity)
+  {
+    std::uint32_t index = entityIndex(entity);
+    std::size_t page = index / PAGE_SIZE;
+    if (page >= sparsePages.size())
+      sparsePages.resize(page + 1);
+    if (!sparsePages[page])
+    {
+      sparsePages[page] = std::make_unique<std::uint32_t[]>(PAGE_SIZE);
+      std::fill(sparsePages[page].get(), sparsePages[page].get() + PAGE_SIZE, INVALID_SLOT);
+    }
+    return sparsePages[page][index % PAGE_SIZE];
+  }
+};
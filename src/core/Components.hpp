@@ -9,6 +9,17 @@ struct Position
   float x, y;
 };
 
+/**
+ * @brief Position at the start of the current simulation tick. Rendering
+ * interpolates from here to Position, so motion stays smooth when the frame
+ * rate and the fixed tick rate differ. Every entity that gets a Position also
+ * gets one; the renderer only draws entities that have both.
+ */
+struct PreviousPosition
+{
+  float x, y;
+};
+
 /**
  * @brief Input component for controllable entities.
  */
@@ -35,14 +46,59 @@ struct Direction
   float angle = 0.0f; // Angle in degrees (0 = right, 90 = down, 180 = left, 270 = up)
 };
 
+/**
+ * @brief How a weapon's projectiles are simulated.
+ */
+enum class ProjectileMode
+{
+  Body,   // Bullet entity with its own Box2D sensor body
+  RayCast // Plain ProjectilePool entry, hit-tested by a ray sweep each tick
+};
+
+/**
+ * @brief How a weapon lays out the projectiles of one trigger pull.
+ */
+enum class WeaponPattern
+{
+  Single, // One projectile along the shooter's direction
+  Spread, // count projectiles fanned evenly across spreadAngle
+  Burst,  // count single shots, burstInterval seconds apart
+  Ring,   // count projectiles evenly around the full circle
+  Spiral  // A ring of count arms that turns by spinRate every volley
+};
+
+/**
+ * @brief Data-driven weapon definition (the "weapon" block of a Shooter in
+ * gamedata.json).
+ */
+struct Weapon
+{
+  WeaponPattern pattern = WeaponPattern::Single;
+  int count = 1;
+  float spreadAngle = 30.0f;   // Degrees (Spread)
+  float burstInterval = 0.05f; // Seconds (Burst)
+  float spinRate = 10.0f;      // Degrees per volley (Spiral)
+  float speed = 400.0f;        // Pixels per second
+  float lifetime = 3.0f;       // Seconds
+  float jitter = 0.0f;         // Degrees of random deviation per projectile, either way (any pattern)
+};
+
 /**
  * @brief Shooter component for entities that can shoot.
  */
 struct Shooter
 {
-  float fireRate = 0.5f; // Bullets per second
+  float fireRate = 0.5f; // Volleys per second
   float lastShotTime = 0.0f;
   bool canShoot = true;
+  ProjectileMode projectileMode = ProjectileMode::Body;
+  Weapon weapon;
+  bool autoFire = false; // AI turrets: fire whenever the fire rate allows, no input needed
+
+  // Pattern state
+  float spinAngle = 0.0f;     // Spiral: current rotation in degrees
+  int burstShotsLeft = 0;     // Burst: shots still to fire
+  float nextBurstTime = 0.0f; // Burst: game time of the next shot
 };
 
 /**
@@ -69,6 +125,23 @@ struct Velocity
  */
 struct CollisionCooldown
 {
-  float lastCollisionTime = 0.0f;
+  float lastCollisionTime = -1.0f; // Simulation seconds; negative so the first contact is never in cooldown
   float cooldownDuration = 0.2f; // 200ms cooldown between collisions
-};
\ No newline at end of file
+};
+/**
+ * @brief Box2D body type of an obstacle.
+ */
+enum class BodyType
+{
+  Static,    // Never moves; costs nothing per tick
+  Kinematic, // Moves at its Velocity, unaffected by hits and contacts
+  Dynamic    // Fully simulated; sleeps when it comes to rest
+};
+
+/**
+ * @brief Physics settings for map obstacles. Obstacles without it are dynamic.
+ */
+struct PhysicsBody
+{
+  BodyType type = BodyType::Dynamic;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Game loop settings, read from the optional "engine" block of
+ * gamedata.json (missing fields keep these defaults).
+ */
+struct EngineConfig
+{
+  int tickRate = 60;          // Fixed simulation ticks per second
+  int maxTicksPerFrame = 8;   // Spiral-of-death cap: further owed ticks are dropped
+  float maxFrameTime = 0.25f; // Longer frames (hitches, breakpoints) are clamped to this
+  bool vsync = true;          // Pace rendering with the display instead of sleeping
+  int workerThreads = 0;      // Threads for systems and the physics solver, main thread included (0 = all cores)
+  int bulletBodyWarmUp = 256; // Pooled bullet bodies created at startup (the pool still grows past this)
+  bool deterministic = false; // Hash the world state every tick so runs can be compared
+  std::uint32_t seed = 0;     // Gameplay RNG seed; 0 picks one from the clock (deterministic runs use 1)
+  bool profiler = true;       // Record profiler zones (P shows the breakdown, F9 saves a trace)
+  float traceSeconds = 5.0f;  // How far back a saved trace reaches
+
+  float tickDt() const { return 1.0f / static_cast<float>(tickRate); }
+};
+
+/**
+ * @brief Command-line overrides, applied on top of the "engine" block.
+ */
+struct LaunchOptions
+{
+  bool deterministic = false; // --deterministic
+  std::uint32_t seed = 0;     // --seed N (0 keeps the configured seed)
+  std::string recordPath;     // --record FILE: write a replay log
+  std::string verifyPath;     // --verify FILE: replay a log and report the first divergent tick
+  bool headless = false;      // --headless: no window, renderer or render systems
+  bool fixedRate = false;     // --fixed-rate: pace headless ticks in real time instead of running flat out
+  std::uint64_t maxTicks = 0; // --ticks N: stop after N ticks (0 = run until quit)
+  std::string tracePath;      // --trace FILE: save a profiler trace on exit (also F9's target)
+};
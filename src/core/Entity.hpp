@@ -1,6 +1,23 @@
 #pragma once
 #include <cstdint>
 /**
- * @brief Entity type for ECS. Typically just a unique integer ID.
+ * @brief Entity handle for ECS: a slot index plus a generation (version).
+ *
+ * The low ENTITY_INDEX_BITS hold the slot index, the remaining high bits hold
+ * the version. Destroying an entity bumps its slot's version before the slot
+ * is recycled, so an old handle never compares equal to the new occupant.
+ * Index 0 is reserved, which keeps NULL_ENTITY (0) from ever being valid.
  */
-using Entity = std::uint32_t;
\ No newline at end of file
+using Entity = std::uint32_t;
+
+constexpr std::uint32_t ENTITY_INDEX_BITS = 20;
+constexpr std::uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr std::uint32_t ENTITY_VERSION_MASK = (1u << (32 - ENTITY_INDEX_BITS)) - 1;
+constexpr Entity NULL_ENTITY = 0;
+
+constexpr std::uint32_t entityIndex(Entity entity) { return entity & ENTITY_INDEX_MASK; }
+constexpr std::uint32_t entityVersion(Entity entity) { return entity >> ENTITY_INDEX_BITS; }
+constexpr Entity makeEntity(std::uint32_t index, std::uint32_t version)
+{
+  return ((version & ENTITY_VERSION_MASK) << ENTITY_INDEX_BITS) | (index & ENTITY_INDEX_MASK);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Typed per-frame event channel.
+ *
+ * Any number of producers may push during a frame; consumers iterate the
+ * contiguous buffer. clear() keeps the capacity, so once the buffer has grown
+ * to the frame's peak event count, pushing no longer allocates.
+ */
+template <typename T>
+class EventQueue
+{
+public:
+  void push(const T &event) { events.push_back(event); }
+
+  bool empty() const { return events.empty(); }
+  std::size_t size() const { return events.size(); }
+  void clear() { events.clear(); }
+
+  typename std::vector<T>::const_iterator begin() const { return events.begin(); }
+  typename std::vector<T>::const_iterator end() const { return events.end(); }
+
+private:
+  std::vector<T> events;
+};
@@ -0,0 +1,91 @@
+#pragma once
+#include "Entity.hpp"
+#include "EventQueue.hpp"
+
+/**
+ * @brief Player movement intent (InputSystem -> MovementSystem).
+ */
+struct MovementEvent
+{
+  Entity entity;
+  float x, y; // Desired velocity in pixels per second
+};
+
+/**
+ * @brief Fire request (InputSystem -> ShootingSystem).
+ */
+struct ShootEvent
+{
+  Entity shooter;
+  float time; // Game time of the request in seconds
+};
+
+/**
+ * @brief An entity that needs a physics body (ShootingSystem -> PhysicsSystem).
+ */
+struct SpawnedEntityEvent
+{
+  Entity entity;
+};
+
+/**
+ * @brief An entity's Position or Velocity was changed outside PhysicsSystem
+ * and its body needs the new values (MovementSystem/ShootingSystem ->
+ * PhysicsSystem). Bodies nobody reports are left to Box2D.
+ */
+struct PhysicsDirtyEvent
+{
+  Entity entity;
+};
+
+/**
+ * @brief A bullet hit an obstacle.
+ */
+struct CollisionEvent
+{
+  Entity bullet; // NULL_ENTITY for ray-cast bullets, which have no entity
+  Entity obstacle;
+};
+
+/**
+ * @brief The player ran into an obstacle.
+ */
+struct PlayerCollisionEvent
+{
+  Entity player;
+  Entity obstacle;
+};
+
+/**
+ * @brief An obstacle bounced off the world boundary.
+ */
+struct BoundaryCollisionEvent
+{
+  Entity entity;
+};
+
+/**
+ * @brief All typed event channels. Events live for the frame they are posted
+ * in: GameEngine clears every channel at the end of update().
+ */
+struct Events
+{
+  EventQueue<MovementEvent> movement;
+  EventQueue<ShootEvent> shoot;
+  EventQueue<SpawnedEntityEvent> spawned;
+  EventQueue<PhysicsDirtyEvent> physicsDirty;
+  EventQueue<CollisionEvent> collision;
+  EventQueue<PlayerCollisionEvent> playerCollision;
+  EventQueue<BoundaryCollisionEvent> boundaryCollision;
+
+  void clear()
+  {
+    movement.clear();
+    shoot.clear();
+    spawned.clear();
+    physicsDirty.clear();
+    collision.clear();
+    playerCollision.clear();
+    boundaryCollision.clear();
+  }
+};
@@ -1,35 +1,69 @@
 #include "GameEngine.hpp"
+#include "BlackboardKeys.hpp"
 #include "Components.hpp"
+#include "Log.hpp"
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <csignal>
 #include <fstream>
-#include <iostream>
 #include <nlohmann/json.hpp>
 #include <unistd.h>
 
-GameEngine::GameEngine()
+namespace
 {
-    std::cout << "[GameEngine] Created" << std::endl;
+    // Set from SIGINT/SIGTERM while running headless, where no SDL_EVENT_QUIT can arrive
+    volatile std::sig_atomic_t headlessStopRequested = 0;
+
+    void requestHeadlessStop(int)
+    {
+        headlessStopRequested = 1;
+    }
+}
+
+GameEngine::GameEngine() : commandBuffer(&manager)
+{
+    LOG_INFO(Engine, "Created");
 }
 
 GameEngine::~GameEngine()
 {
     shutdown();
-    std::cout << "[GameEngine] Destroyed" << std::endl;
+    LOG_INFO(Engine, "Destroyed");
 }
 
 bool GameEngine::initialize()
 {
-    std::cout << "[GameEngine] Initializing..." << std::endl;
+    LOG_INFO(Engine, "Initializing...");
 
-    if (!initializeSDL())
+    // Thread counts must be known before the pool and physics world exist
+    loadEngineConfig();
+    if (!applyLaunchOptions())
     {
         return false;
     }
+    if (config.workerThreads != 1)
+    {
+        // 0 lets the pool use every core; otherwise the main thread is one of the threads
+        threadPool = std::make_unique<ThreadPool>(config.workerThreads > 1 ? config.workerThreads - 1 : 0);
+    }
+    scheduler.setThreadPool(threadPool.get());
+    Profiler::instance().setEnabled(config.profiler);
 
-    // Create rendering system
-    renderingSystem = std::make_unique<RenderingSystem>(renderer, &manager);
+    // Headless runs have no display: no video, window, renderer or render systems
+    if (!launchOptions.headless)
+    {
+        if (!initializeSDL())
+        {
+            return false;
+        }
+
+        // Create rendering system
+        renderingSystem = std::make_unique<RenderingSystem>(renderer, &manager);
 
-    // Create HUD system
-    hudSystem = std::make_unique<HUDSystem>(renderer);
+        // Create HUD system
+        hudSystem = std::make_unique<HUDSystem>(renderer);
+    }
 
     // Create movement system
     movementSystem = std::make_unique<MovementSystem>();
@@ -38,21 +72,53 @@ bool GameEngine::initialize()
     shootingSystem = std::make_unique<ShootingSystem>(&manager);
 
     // Create physics system
-    physicsSystem = std::make_unique<PhysicsSystem>(&manager);
+    physicsSystem = std::make_unique<PhysicsSystem>(&manager, threadPool.get());
+    physicsSystem->warmUpBodies(physicsSystem->getBulletTemplate(), static_cast<std::size_t>(config.bulletBodyWarmUp));
 
     // Create map system
     mapSystem = std::make_unique<MapSystem>(&manager);
 
-    // Setup blackboard for all systems
-    inputSystem.setBlackboard(&blackboard);
-    movementSystem->setBlackboard(&blackboard);
-    shootingSystem->setBlackboard(&blackboard);
-    physicsSystem->setBlackboard(&blackboard);
-    mapSystem->setBlackboard(&blackboard);
-    renderingSystem->setBlackboard(&blackboard);
-    hudSystem->setBlackboard(&blackboard);
+    systems = {&inputSystem, movementSystem.get(), shootingSystem.get(), physicsSystem.get(), mapSystem.get()};
+
+    // Registration order is the serial update order; the scheduler only
+    // reorders systems whose declared access doesn't conflict
+    scheduler.addSystem(&inputSystem, "InputSystem");
+    scheduler.addSystem(movementSystem.get(), "MovementSystem");
+    scheduler.addSystem(shootingSystem.get(), "ShootingSystem");
+    scheduler.addSystem(physicsSystem.get(), "PhysicsSystem");
+    scheduler.addSystem(mapSystem.get(), "MapSystem");
+    if (!launchOptions.headless)
+    {
+        systems.push_back(renderingSystem.get());
+        systems.push_back(hudSystem.get());
+        scheduler.addSystem(renderingSystem.get(), "RenderingSystem");
+        scheduler.addSystem(hudSystem.get(), "HUDSystem");
+    }
+
+    // Ray-cast bullets live in one engine-owned pool shared by these three
+    shootingSystem->setProjectilePool(&projectilePool);
+    shootingSystem->setRandom(&random); // Seeded, so jitter replays exactly in deterministic runs
+    physicsSystem->setProjectilePool(&projectilePool);
+    if (renderingSystem)
+    {
+        renderingSystem->setProjectilePool(&projectilePool);
+    }
+
+    // Create the shared-state slots up front so per-frame access never allocates
+    blackboard.declare(BlackboardKeys::HUD_TOGGLE_REQUEST, false);
+    blackboard.declare(BlackboardKeys::EXIT_GAME_REQUEST, false);
+    blackboard.declare(BlackboardKeys::PROFILER_OVERLAY_REQUEST, false);
+    blackboard.declare(BlackboardKeys::PROFILER_DUMP_REQUEST, false);
 
-    std::cout << "[GameEngine] Blackboard setup complete" << std::endl;
+    // Setup blackboard, event channels and command buffer for all systems
+    for (System *system : systems)
+    {
+        system->setBlackboard(&blackboard);
+        system->setEvents(&events);
+        system->setCommandBuffer(&commandBuffer);
+    }
+
+    LOG_INFO(Engine, "Blackboard setup complete");
 
     if (!loadGameData())
     {
@@ -62,13 +128,18 @@ bool GameEngine::initialize()
     // Load map
     if (!mapSystem->loadMap("assets/map1.json"))
     {
-        std::cerr << "[GameEngine] Failed to load map" << std::endl;
+        LOG_ERROR(Engine, "Failed to load map");
         return false;
     }
 
     // Create map entities
     mapSystem->createMapEntities();
 
+    // Size the gameplay spatial hash for this map's obstacles and wall the world in
+    const MapData &mapData = mapSystem->getMapData();
+    physicsSystem->setSpatialCellSize(mapData.cellSize);
+    physicsSystem->setWorldBounds(static_cast<float>(mapData.width), static_cast<float>(mapData.height));
+
     // Register all obstacle entities with physics system
     for (Entity entity : manager.getAllEntities())
     {
@@ -79,12 +150,16 @@ bool GameEngine::initialize()
         }
     }
 
-    std::cout << "[GameEngine] Map loaded successfully" << std::endl;
+    LOG_INFO(Engine, "Map loaded successfully");
+
+    // Fall back to a short sleep per frame if the driver refuses vsync
+    vsyncEnabled = renderer && config.vsync && SDL_SetRenderVSync(renderer, 1);
+    LOG_INFO(Engine, "Fixed timestep: %d ticks/s, %s", config.tickRate,
+             launchOptions.headless ? "headless" : vsyncEnabled ? "vsync on" : "vsync off");
 
     running = true;
-    lastTicks = SDL_GetTicks();
 
-    std::cout << "[GameEngine] Initialization complete" << std::endl;
+    LOG_INFO(Engine, "Initialization complete");
     return true;
 }
 
@@ -94,13 +169,13 @@ bool GameEngine::initializeSDL()
     char cwd[1024];
     if (getcwd(cwd, sizeof(cwd)) != nullptr)
     {
-        std::cout << "[GameEngine] Current working dir: " << cwd << std::endl;
+        LOG_INFO(Engine, "Current working dir: %s", cwd);
     }
 
     // Initialize SDL
     if (!SDL_Init(SDL_INIT_VIDEO))
     {
-        std::cerr << "[GameEngine] SDL_Init Error: '" << SDL_GetError() << "'" << std::endl;
+        LOG_ERROR(Engine, "SDL_Init Error: '%s'", SDL_GetError());
         return false;
     }
 
@@ -108,7 +183,7 @@ bool GameEngine::initializeSDL()
     window = SDL_CreateWindow(WINDOW_TITLE, WINDOW_WIDTH, WINDOW_HEIGHT, 0);
     if (!window)
     {
-        std::cerr << "[GameEngine] SDL_CreateWindow Error: '" << SDL_GetError() << "'" << std::endl;
+        LOG_ERROR(Engine, "SDL_CreateWindow Error: '%s'", SDL_GetError());
         return false;
     }
 
@@ -116,22 +191,84 @@ bool GameEngine::initializeSDL()
     renderer = SDL_CreateRenderer(window, nullptr);
     if (!renderer)
     {
-        std::cerr << "[GameEngine] SDL_CreateRenderer Error: '" << SDL_GetError() << "'" << std::endl;
+        LOG_ERROR(Engine, "SDL_CreateRenderer Error: '%s'", SDL_GetError());
+        return false;
+    }
+
+    LOG_INFO(Engine, "SDL initialized successfully");
+    return true;
+}
+
+void GameEngine::loadEngineConfig()
+{
+    // Optional game loop settings; a missing or broken file keeps the
+    // defaults here and is reported by loadGameData()
+    std::ifstream file("gamedata.json");
+    nlohmann::json data = nlohmann::json::parse(file, nullptr, false);
+    if (data.is_discarded() || !data.contains("engine"))
+        return;
+
+    const auto &engine = data["engine"];
+    config.tickRate = std::max(1, engine.value("tickRate", config.tickRate));
+    config.maxTicksPerFrame = std::max(1, engine.value("maxTicksPerFrame", config.maxTicksPerFrame));
+    config.maxFrameTime = engine.value("maxFrameTime", config.maxFrameTime);
+    config.vsync = engine.value("vsync", config.vsync);
+    config.workerThreads = std::max(0, engine.value("workerThreads", config.workerThreads));
+    config.bulletBodyWarmUp = std::max(0, engine.value("bulletBodyWarmUp", config.bulletBodyWarmUp));
+    config.deterministic = engine.value("deterministic", config.deterministic);
+    config.seed = engine.value("seed", config.seed);
+    config.profiler = engine.value("profiler", config.profiler);
+    config.traceSeconds = std::max(0.0f, engine.value("traceSeconds", config.traceSeconds));
+}
+
+bool GameEngine::applyLaunchOptions()
+{
+    config.deterministic = config.deterministic || launchOptions.deterministic;
+    if (launchOptions.seed != 0)
+    {
+        config.seed = launchOptions.seed;
+    }
+
+    // A verify run must reproduce the recording's settings, whatever the config says
+    if (!launchOptions.verifyPath.empty())
+    {
+        if (!replay.openVerify(launchOptions.verifyPath))
+        {
+            return false;
+        }
+        config.deterministic = true;
+        config.seed = replay.getSeed();
+        config.tickRate = std::max(1, replay.getTickRate());
+    }
+    else if (!launchOptions.recordPath.empty())
+    {
+        config.deterministic = true;
+    }
+
+    if (config.seed == 0)
+    {
+        config.seed = config.deterministic ? 1u : static_cast<std::uint32_t>(SDL_GetPerformanceCounter());
+    }
+    random.reseed(config.seed);
+
+    if (replay.getMode() == ReplayLog::Mode::Off && !launchOptions.recordPath.empty() &&
+        !replay.openRecord(launchOptions.recordPath, config.seed, config.tickRate))
+    {
         return false;
     }
 
-    std::cout << "[GameEngine] SDL initialized successfully" << std::endl;
+    LOG_INFO(Engine, "Seed %u, deterministic mode %s", config.seed, config.deterministic ? "on" : "off");
     return true;
 }
 
 bool GameEngine::loadGameData()
 {
-    std::cout << "[GameEngine] Loading game data..." << std::endl;
+    LOG_INFO(Engine, "Loading game data...");
 
     std::ifstream file("gamedata.json");
     if (!file.is_open())
     {
-        std::cerr << "[GameEngine] Failed to open gamedata.json" << std::endl;
+        LOG_ERROR(Engine, "Failed to open gamedata.json");
         return false;
     }
 
@@ -139,7 +276,7 @@ bool GameEngine::loadGameData()
     file >> data;
     if (file.fail())
     {
-        std::cerr << "[GameEngine] Failed to parse gamedata.json or file is empty." << std::endl;
+        LOG_ERROR(Engine, "Failed to parse gamedata.json or file is empty.");
         return false;
     }
     file.close();
@@ -150,14 +287,14 @@ bool GameEngine::loadGameData()
         createEntityFromJSON(entityData);
     }
 
-    std::cout << "[GameEngine] Game data loaded successfully" << std::endl;
+    LOG_INFO(Engine, "Game data loaded successfully");
     return true;
 }
 
 void GameEngine::createEntityFromJSON(const nlohmann::json &entityData)
 {
     Entity entity = manager.createEntity();
-    std::cout << "[GameEngine] Creating entity " << entity << " (" << entityData["name"] << ")" << std::endl;
+    LOG_DEBUG(Engine, "Creating entity %u (%s)", entity, entityData.value("name", "").c_str());
 
     const auto &components = entityData["components"];
 
@@ -165,7 +302,8 @@ void GameEngine::createEntityFromJSON(const nlohmann::json &entityData)
     {
         Position pos{components["Position"]["x"], components["Position"]["y"]};
         addComponent<Position>(entity, pos);
-        std::cout << "[GameEngine] Added Position component to entity " << entity << std::endl;
+        addComponent<PreviousPosition>(entity, {pos.x, pos.y});
+        LOG_DEBUG(Engine, "Added Position component to entity %u", entity);
     }
 
     if (components.contains("Input"))
@@ -173,7 +311,7 @@ void GameEngine::createEntityFromJSON(const nlohmann::json &entityData)
         Input input{components["Input"]["controllable"]};
         addComponent<Input>(entity, input);
         inputSystem.entities.push_back(entity);
-        std::cout << "[GameEngine] Added Input component to entity " << entity << std::endl;
+        LOG_DEBUG(Engine, "Added Input component to entity %u", entity);
     }
 
     if (components.contains("Renderable"))
@@ -188,24 +326,35 @@ void GameEngine::createEntityFromJSON(const nlohmann::json &entityData)
             renderable.showDirection = components["Renderable"]["showDirection"];
         }
         addComponent<Renderable>(entity, renderable);
-        std::cout << "[GameEngine] Added Renderable component to entity " << entity << std::endl;
+        LOG_DEBUG(Engine, "Added Renderable component to entity %u", entity);
     }
 
     if (components.contains("Direction"))
     {
         Direction direction{components["Direction"]["angle"]};
         addComponent<Direction>(entity, direction);
-        std::cout << "[GameEngine] Added Direction component to entity " << entity << std::endl;
+        LOG_DEBUG(Engine, "Added Direction component to entity %u", entity);
     }
 
     if (components.contains("Shooter"))
     {
-        Shooter shooter{
-            components["Shooter"]["fireRate"],
-            components["Shooter"]["lastShotTime"],
-            components["Shooter"]["canShoot"]};
+        // Fields not in the JSON keep their defaults (see Components.hpp)
+        Shooter shooter;
+        shooter.fireRate = components["Shooter"]["fireRate"];
+        shooter.lastShotTime = components["Shooter"]["lastShotTime"];
+        shooter.canShoot = components["Shooter"]["canShoot"];
+        // "body" (default): bullet entities with physics bodies; "ray": pooled ray-cast bullets
+        if (components["Shooter"].value("projectile", "body") == "ray")
+        {
+            shooter.projectileMode = ProjectileMode::RayCast;
+        }
+        shooter.autoFire = components["Shooter"].value("autoFire", false);
+        if (components["Shooter"].contains("weapon"))
+        {
+            shooter.weapon = parseWeapon(components["Shooter"]["weapon"]);
+        }
         addComponent<Shooter>(entity, shooter);
-        std::cout << "[GameEngine] Added Shooter component to entity " << entity << std::endl;
+        LOG_DEBUG(Engine, "Added Shooter component to entity %u", entity);
     }
 
     if (components.contains("Velocity"))
@@ -214,35 +363,182 @@ void GameEngine::createEntityFromJSON(const nlohmann::json &entityData)
             components["Velocity"]["x"],
             components["Velocity"]["y"]};
         addComponent<Velocity>(entity, velocity);
-        movementSystem->entities.push_back(entity);
         physicsSystem->addEntity(entity);
-        std::cout << "[GameEngine] Added Velocity component to entity " << entity << std::endl;
+        LOG_DEBUG(Engine, "Added Velocity component to entity %u", entity);
     }
 }
 
+Weapon GameEngine::parseWeapon(const nlohmann::json &weaponData)
+{
+    Weapon weapon;
+    const std::string pattern = weaponData.value("pattern", "single");
+    if (pattern == "spread")
+        weapon.pattern = WeaponPattern::Spread;
+    else if (pattern == "burst")
+        weapon.pattern = WeaponPattern::Burst;
+    else if (pattern == "ring")
+        weapon.pattern = WeaponPattern::Ring;
+    else if (pattern == "spiral")
+        weapon.pattern = WeaponPattern::Spiral;
+    else if (pattern != "single")
+        LOG_WARN(Engine, "Unknown weapon pattern '%s', using single", pattern.c_str());
+
+    weapon.count = std::max(1, weaponData.value("count", weapon.count));
+    weapon.spreadAngle = weaponData.value("spreadAngle", weapon.spreadAngle);
+    weapon.burstInterval = weaponData.value("burstInterval", weapon.burstInterval);
+    weapon.spinRate = weaponData.value("spinRate", weapon.spinRate);
+    weapon.speed = weaponData.value("speed", weapon.speed);
+    weapon.lifetime = weaponData.value("lifetime", weapon.lifetime);
+    weapon.jitter = std::max(0.0f, weaponData.value("jitter", weapon.jitter));
+    return weapon;
+}
+
 void GameEngine::run()
 {
-    std::cout << "[GameEngine] Starting game loop..." << std::endl;
+    if (launchOptions.headless)
+    {
+        runHeadless();
+        return;
+    }
 
+    LOG_INFO(Engine, "Starting game loop...");
+
+    // The simulation always advances in fixed ticks; real elapsed time is
+    // banked in the accumulator and spent one tick at a time
+    const double tickDt = config.tickDt();
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    Uint64 lastCounter = SDL_GetPerformanceCounter();
+    double accumulator = 0.0;
+
+    Profiler &profiler = Profiler::instance();
     while (running)
     {
+        profiler.beginFrame();
         handleEvents();
 
-        Uint32 now = SDL_GetTicks();
-        float dt = (now - lastTicks) / 1000.0f;
-        lastTicks = now;
+        if (blackboard.get(BlackboardKeys::PROFILER_DUMP_REQUEST))
+        {
+            blackboard.set(BlackboardKeys::PROFILER_DUMP_REQUEST, false);
+            saveTrace();
+        }
+
+        Uint64 now = SDL_GetPerformanceCounter();
+        double frameTime = (now - lastCounter) / frequency;
+        lastCounter = now;
 
-        update(dt);
-        render();
+        // A hitch (window drag, breakpoint) must not turn into a burst of catch-up ticks
+        accumulator += std::min(frameTime, static_cast<double>(config.maxFrameTime));
 
-        SDL_Delay(16); // ~60 FPS
+        int ticks = 0;
+        while (running && accumulator >= tickDt && ticks < config.maxTicksPerFrame)
+        {
+            update(static_cast<float>(tickDt));
+            accumulator -= tickDt;
+            ++ticks;
+        }
+
+        // Spiral-of-death protection: if ticks cost more than they cover, drop
+        // what is still owed (the game slows down) instead of falling further behind
+        if (accumulator >= tickDt)
+        {
+            LOG_DEBUG(Engine, "Dropped %d ticks", static_cast<int>(accumulator / tickDt));
+            accumulator = std::fmod(accumulator, tickDt);
+        }
+
+        // Draw the fraction of the way from the previous tick's state to the current one
+        render(static_cast<float>(accumulator / tickDt));
+
+        if (!vsyncEnabled)
+        {
+            SDL_Delay(1);
+        }
+        profiler.endFrame();
     }
 
-    std::cout << "[GameEngine] Game loop ended" << std::endl;
+    LOG_INFO(Engine, "Game loop ended");
+    if (!launchOptions.tracePath.empty())
+    {
+        saveTrace();
+    }
+}
+
+void GameEngine::runHeadless()
+{
+    LOG_INFO(Engine, "Starting headless loop (%s)...", launchOptions.fixedRate ? "fixed rate" : "unthrottled");
+
+    // No frames and no accumulator: each iteration is exactly one tick
+    const float tickDt = config.tickDt();
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    const Uint64 countsPerTick = static_cast<Uint64>(frequency / config.tickRate);
+    const Uint64 startCounter = SDL_GetPerformanceCounter();
+    const std::uint64_t startTick = tickCount;
+    Uint64 nextTickCounter = startCounter;
+    Profiler &profiler = Profiler::instance();
+
+    // Without --ticks the run ends on Ctrl+C or a kill, which still stops
+    // between ticks so the summary below is printed
+    headlessStopRequested = 0;
+    auto previousInterrupt = std::signal(SIGINT, requestHeadlessStop);
+    auto previousTerminate = std::signal(SIGTERM, requestHeadlessStop);
+
+    while (running && !headlessStopRequested)
+    {
+        if (launchOptions.fixedRate)
+        {
+            Uint64 now = SDL_GetPerformanceCounter();
+            if (now < nextTickCounter)
+            {
+                SDL_DelayNS(static_cast<Uint64>((nextTickCounter - now) * 1e9 / frequency));
+            }
+            nextTickCounter += countsPerTick;
+        }
+
+        profiler.beginFrame();
+        update(tickDt);
+        profiler.endFrame();
+    }
+
+    std::signal(SIGINT, previousInterrupt);
+    std::signal(SIGTERM, previousTerminate);
+    if (headlessStopRequested)
+    {
+        LOG_INFO(Engine, "Headless run interrupted");
+    }
+
+    // Throughput of the simulation alone, for comparing builds and thread counts
+    const double seconds = (SDL_GetPerformanceCounter() - startCounter) / frequency;
+    const std::uint64_t ticks = tickCount - startTick;
+    const double simulated = ticks * static_cast<double>(tickDt);
+    LOG_INFO(Engine, "Headless run: %llu ticks in %.3f s, %.1f ticks/s, %.3f ms/tick, %.1fx real time",
+             static_cast<unsigned long long>(ticks), seconds, seconds > 0.0 ? ticks / seconds : 0.0,
+             ticks > 0 ? seconds * 1000.0 / ticks : 0.0, seconds > 0.0 ? simulated / seconds : 0.0);
+    LOG_INFO(Engine, "Final state: %zu entities, %zu ray-cast projectiles", manager.getEntityCount(),
+             projectilePool.size());
+    if (config.deterministic)
+    {
+        LOG_INFO(Engine, "Final state hash: %016llx", static_cast<unsigned long long>(stateHash));
+    }
+    if (!launchOptions.tracePath.empty())
+    {
+        saveTrace();
+    }
+}
+
+void GameEngine::saveTrace()
+{
+    // Frames are only recorded while the profiler is on
+    if (!config.profiler)
+    {
+        LOG_WARN(Engine, "Profiler is disabled (engine.profiler), no trace to save");
+        return;
+    }
+    const std::string path = launchOptions.tracePath.empty() ? "trace.json" : launchOptions.tracePath;
+    Profiler::instance().writeChromeTrace(path, config.traceSeconds);
 }
 
 void GameEngine::handleEvents()
 {
+    PROFILE_ZONE("PollEvents");
     SDL_Event event;
     while (SDL_PollEvent(&event))
     {
@@ -250,6 +546,10 @@ void GameEngine::handleEvents()
         {
             running = false;
         }
+        else if (event.type == SDL_EVENT_RENDER_TARGETS_RESET && hudSystem)
+        {
+            hudSystem->invalidateTextCache();
+        }
         inputSystem.handleEvent(event);
     }
 }
@@ -257,31 +557,154 @@ void GameEngine::handleEvents()
 void GameEngine::update(float dt)
 {
     // Check for exit game request
-    if (blackboard.has("exit_game_request") && blackboard.getValue<bool>("exit_game_request"))
+    if (blackboard.get(BlackboardKeys::EXIT_GAME_REQUEST))
     {
         running = false;
-        std::cout << "[GameEngine] Exit game request received" << std::endl;
+        LOG_INFO(Engine, "Exit game request received");
         return;
     }
 
-    inputSystem.update(dt);
-    movementSystem->update(dt);
-    shootingSystem->update(dt);
-    physicsSystem->update(dt);
-    mapSystem->update(dt);
-    renderingSystem->update(dt);
-    hudSystem->update(dt);
+    // A replay drives input from the log instead of the keyboard
+    std::uint32_t keys = 0;
+    if (replay.isVerifying())
+    {
+        if (!replay.nextKeys(keys))
+        {
+            LOG_INFO(Engine, "Replay verified: all %zu ticks match", replay.getTickCount());
+            running = false;
+            return;
+        }
+        inputSystem.setKeyMask(keys);
+    }
+    else if (replay.isRecording())
+    {
+        keys = inputSystem.getKeyMask();
+    }
+
+    snapshotPositions();
+
+    // Run all systems; non-conflicting ones overlap on the thread pool
+    scheduler.run(dt);
+
+    // Frame sync point: apply deferred structural changes in one batch
+    {
+        PROFILE_ZONE("FlushCommands");
+        flushCommands();
+    }
+
+    // Events only live for the frame they were posted in
+    events.clear();
+
+    ++tickCount;
+    if (launchOptions.maxTicks != 0 && tickCount >= launchOptions.maxTicks)
+    {
+        running = false;
+    }
+    if (config.deterministic)
+    {
+        stateHash = computeStateHash();
+        if (replay.isRecording())
+        {
+            replay.record(tickCount, keys, stateHash);
+        }
+        else if (replay.isVerifying() && !replay.verify(tickCount, stateHash))
+        {
+            running = false;
+            exitCode = 1;
+        }
+    }
 }
 
-void GameEngine::render()
+std::uint64_t GameEngine::computeStateHash() const
 {
-    renderingSystem->render();
+    // Chained onto the previous tick's hash, so a divergence stays visible in
+    // every later tick; pools are walked in their dense order, which only
+    // depends on the order entities were created and destroyed in
+    StateHash hash;
+    hash.add(stateHash);
+    hash.add(tickCount);
+
+    view<Position>().each(
+        [&](Entity entity, Position &pos)
+        {
+            hash.add(entity);
+            hash.add(pos);
+        });
+    view<Velocity>().each(
+        [&](Entity entity, Velocity &vel)
+        {
+            hash.add(entity);
+            hash.add(vel);
+        });
+    view<Direction>().each(
+        [&](Entity entity, Direction &dir)
+        {
+            hash.add(entity);
+            hash.add(dir.angle);
+        });
+    view<Shooter>().each(
+        [&](Entity entity, Shooter &shooter)
+        {
+            hash.add(entity);
+            hash.add(shooter.lastShotTime);
+            hash.add(shooter.spinAngle);
+            hash.add(shooter.burstShotsLeft);
+            hash.add(shooter.nextBurstTime);
+        });
+
+    const std::size_t projectileBytes = projectilePool.size() * sizeof(float);
+    for (const float *array : {projectilePool.getX(), projectilePool.getY(), projectilePool.getVelocityX(),
+                               projectilePool.getVelocityY(), projectilePool.getTimeAlive()})
+    {
+        hash.add(array, projectileBytes);
+    }
+
+    physicsSystem->hashBodies(hash);
+    return hash.value();
+}
+
+void GameEngine::snapshotPositions()
+{
+    // Start-of-tick state for render interpolation
+    view<Position, PreviousPosition>().each(
+        [](Entity, Position &pos, PreviousPosition &previous)
+        {
+            previous.x = pos.x;
+            previous.y = pos.y;
+        });
+}
+
+void GameEngine::flushCommands()
+{
+    commandBuffer.flush();
+
+    const std::vector<Entity> &destroyed = commandBuffer.getDestroyedEntities();
+    if (destroyed.empty())
+        return;
+
+    for (System *system : systems)
+    {
+        system->onEntitiesDestroyed(destroyed);
+    }
+}
+
+void GameEngine::render(float alpha)
+{
+    if (!renderingSystem)
+        return;
+
+    // The HUD draws over the scene, so the frame is presented after both
+    renderingSystem->render(alpha);
     hudSystem->render();
+    renderingSystem->present();
 }
 
 void GameEngine::shutdown()
 {
-    std::cout << "[GameEngine] Shutting down..." << std::endl;
+    LOG_INFO(Engine, "Shutting down...");
+
+    scheduler.report();
+    scheduler.clear();
 
     renderingSystem.reset();
     hudSystem.reset();
@@ -299,5 +722,5 @@ void GameEngine::shutdown()
     }
 
     SDL_Quit();
-    std::cout << "[GameEngine] Shutdown complete" << std::endl;
+    LOG_INFO(Engine, "Shutdown complete");
 }
@@ -1,6 +1,13 @@
 #pragma once
 #include "Manager.hpp"
 #include "Blackboard.hpp"
+#include "CommandBuffer.hpp"
+#include "EngineConfig.hpp"
+#include "Events.hpp"
+#include "Random.hpp"
+#include "ReplayLog.hpp"
+#include "Scheduler.hpp"
+#include "ThreadPool.hpp"
 #include "../input/InputSystem.hpp"
 #include "../movement/MovementSystem.hpp"
 #include "../gameplay/ShootingSystem.hpp"
@@ -10,8 +17,10 @@
 #include "../rendering/HUDSystem.hpp"
 #include <SDL3/SDL.h>
 #include <nlohmann/json.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 /**
  * @brief Main game engine class that manages all systems and game loop
@@ -22,10 +31,20 @@ public:
     GameEngine();
     ~GameEngine();
 
+    // Command-line overrides; call before initialize()
+    void setLaunchOptions(const LaunchOptions &options) { launchOptions = options; }
+
     bool initialize();
     void run();
     void shutdown();
 
+    // Process exit status: nonzero when a replay diverged
+    int getExitCode() const { return exitCode; }
+
+    // Rolling hash of the ECS and physics state after the last tick (deterministic mode)
+    std::uint64_t getStateHash() const { return stateHash; }
+    std::uint64_t getTickCount() const { return tickCount; }
+
     // System access
     Manager *getManager() { return &manager; }
     InputSystem *getInputSystem() { return &inputSystem; }
@@ -36,11 +55,25 @@ public:
     RenderingSystem *getRenderingSystem() { return renderingSystem.get(); }
     HUDSystem *getHUDSystem() { return hudSystem.get(); }
     Blackboard *getBlackboard() { return &blackboard; }
+    CommandBuffer *getCommandBuffer() { return &commandBuffer; }
+    Events *getEvents() { return &events; }
+    ProjectilePool *getProjectilePool() { return &projectilePool; }
+    Scheduler *getScheduler() { return &scheduler; }
+    Random *getRandom() { return &random; }
+    ThreadPool *getThreadPool() { return threadPool.get(); }
+    const EngineConfig &getConfig() const { return config; }
 
 private:
     // Core systems
     Manager manager;
     Blackboard blackboard;
+    CommandBuffer commandBuffer;
+    Events events;
+    ProjectilePool projectilePool;
+    Random random;
+    ReplayLog replay;
+    std::unique_ptr<ThreadPool> threadPool; // Sized from the config, nullptr when single-threaded
+    Scheduler scheduler;
     InputSystem inputSystem;
     std::unique_ptr<MovementSystem> movementSystem;
     std::unique_ptr<ShootingSystem> shootingSystem;
@@ -49,13 +82,21 @@ private:
     std::unique_ptr<RenderingSystem> renderingSystem;
     std::unique_ptr<HUDSystem> hudSystem;
 
+    // All systems in registration (update) order
+    std::vector<System *> systems;
+
     // SDL components
     SDL_Window *window = nullptr;
     SDL_Renderer *renderer = nullptr;
 
     // Game state
+    EngineConfig config;
+    LaunchOptions launchOptions;
     bool running = false;
-    Uint32 lastTicks = 0;
+    bool vsyncEnabled = false;
+    int exitCode = 0;
+    std::uint64_t tickCount = 0;
+    std::uint64_t stateHash = 0;
 
     // Configuration
     static constexpr int WINDOW_WIDTH = 800;
@@ -64,9 +105,17 @@ private:
 
     // Private methods
     bool initializeSDL();
+    void loadEngineConfig();
+    bool applyLaunchOptions();
     bool loadGameData();
     void handleEvents();
+    void saveTrace();
+    void runHeadless();
     void update(float dt);
-    void render();
+    void snapshotPositions();
+    void flushCommands();
+    std::uint64_t computeStateHash() const;
+    void render(float alpha);
     void createEntityFromJSON(const nlohmann::json &entityData);
+    static Weapon parseWeapon(const nlohmann::json &weaponData);
 };
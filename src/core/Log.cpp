@@ -0,0 +1,252 @@
+#include "Log.hpp"
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+  const char *CATEGORY_NAMES[] = {
+      "GameEngine", "Manager", "Blackboard", "InputSystem", "MovementSystem",
+      "ShootingSystem", "PhysicsSystem", "MapSystem", "Rendering", "HUDSystem"};
+
+  const char *LEVEL_NAMES[] = {"trace", "debug", "info", "warn", "error", "off"};
+
+  std::uint64_t nowUs()
+  {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+  }
+
+  bool parseLevel(const std::string &name, LogLevel &level)
+  {
+    for (int i = 0; i <= static_cast<int>(LogLevel::Off); ++i)
+    {
+      if (name == LEVEL_NAMES[i])
+      {
+        level = static_cast<LogLevel>(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool parseCategory(const std::string &name, LogCategory &category)
+  {
+    if (name.empty())
+      return false;
+
+    for (int i = 0; i < static_cast<int>(LogCategory::Count); ++i)
+    {
+      // Accept both "PhysicsSystem" and the short "physics"
+      std::string full = CATEGORY_NAMES[i];
+      std::string lower;
+      for (char c : full)
+        lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      if (name == full || name == lower || lower.rfind(name, 0) == 0)
+      {
+        category = static_cast<LogCategory>(i);
+        return true;
+      }
+    }
+    return false;
+  }
+}
+
+Logger &Logger::instance()
+{
+  static Logger logger;
+  return logger;
+}
+
+Logger::Logger() : ring(new Cell[RING_CAPACITY])
+{
+  for (std::size_t i = 0; i < RING_CAPACITY; ++i)
+  {
+    ring[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  setLevel(LogLevel::Info);
+  if (const char *spec = std::getenv("LOG_LEVEL"))
+  {
+    configure(spec);
+  }
+
+  running.store(true);
+  writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger()
+{
+  shutdown();
+}
+
+void Logger::setLevel(LogLevel level)
+{
+  for (auto &categoryLevel : levels)
+  {
+    categoryLevel.store(level, std::memory_order_relaxed);
+  }
+}
+
+void Logger::setLevel(LogCategory category, LogLevel level)
+{
+  levels[static_cast<std::size_t>(category)].store(level, std::memory_order_relaxed);
+}
+
+void Logger::configure(const char *spec)
+{
+  std::string remaining = spec ? spec : "";
+  while (!remaining.empty())
+  {
+    std::size_t comma = remaining.find(',');
+    std::string item = remaining.substr(0, comma);
+    remaining = (comma == std::string::npos) ? "" : remaining.substr(comma + 1);
+
+    LogLevel level;
+    LogCategory category;
+    std::size_t equals = item.find('=');
+    if (equals == std::string::npos)
+    {
+      if (parseLevel(item, level))
+        setLevel(level);
+    }
+    else if (parseCategory(item.substr(0, equals), category) && parseLevel(item.substr(equals + 1), level))
+    {
+      setLevel(category, level);
+    }
+  }
+}
+
+void Logger::write(LogCategory category, LogLevel level, const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  if (!running.load(std::memory_order_acquire) || !enqueue(category, level, format, args))
+  {
+    // Write through when the writer thread has stopped (e.g. during static
+    // destruction), and for warnings/errors that found the ring full
+    if (level >= LogLevel::Warn || !running.load(std::memory_order_acquire))
+    {
+      FILE *stream = level >= LogLevel::Warn ? stderr : stdout;
+      std::fprintf(stream, "[%s] ", CATEGORY_NAMES[static_cast<std::size_t>(category)]);
+      std::vfprintf(stream, format, args);
+      std::fputc('\n', stream);
+    }
+  }
+  va_end(args);
+}
+
+bool Logger::enqueue(LogCategory category, LogLevel level, const char *format, va_list args)
+{
+  // Claim a cell (bounded MPMC ring, Vyukov-style sequence numbers)
+  Cell *cell;
+  std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    cell = &ring[pos & (RING_CAPACITY - 1)];
+    std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+    if (diff == 0)
+    {
+      if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+    {
+      // Ring is full; never block the game loop on logging
+      if (level < LogLevel::Warn)
+        dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+    {
+      pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  Record &record = cell->record;
+  record.timestampUs = nowUs();
+  record.level = level;
+  record.category = category;
+
+  std::vsnprintf(record.message, MESSAGE_SIZE, format, args);
+
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+std::size_t Logger::drain()
+{
+  std::size_t count = 0;
+  for (;;)
+  {
+    Cell &cell = ring[dequeuePos & (RING_CAPACITY - 1)];
+    if (cell.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+      break;
+
+    const Record &record = cell.record;
+    FILE *stream = record.level >= LogLevel::Warn ? stderr : stdout;
+    std::fprintf(stream, "[%s] %s\n", CATEGORY_NAMES[static_cast<std::size_t>(record.category)], record.message);
+
+    cell.sequence.store(dequeuePos + RING_CAPACITY, std::memory_order_release);
+    ++dequeuePos;
+    ++count;
+  }
+
+  if (count > 0)
+  {
+    std::fflush(stdout);
+    std::fflush(stderr);
+    written.store(dequeuePos, std::memory_order_release);
+  }
+  return count;
+}
+
+void Logger::writerLoop()
+{
+  std::uint64_t reportedDrops = 0;
+  while (running.load(std::memory_order_acquire))
+  {
+    if (drain() == 0)
+    {
+      // Producers never signal (that would cost them a syscall); poll instead
+      std::unique_lock<std::mutex> lock(wakeMutex);
+      wake.wait_for(lock, std::chrono::milliseconds(5));
+    }
+
+    std::uint64_t drops = dropped.load(std::memory_order_relaxed);
+    if (drops != reportedDrops)
+    {
+      std::fprintf(stderr, "[Logger] Dropped %llu messages (ring buffer full)\n",
+                   static_cast<unsigned long long>(drops - reportedDrops));
+      reportedDrops = drops;
+    }
+  }
+  drain();
+}
+
+void Logger::flush()
+{
+  std::size_t target = enqueuePos.load(std::memory_order_acquire);
+  while (running.load(std::memory_order_acquire) && written.load(std::memory_order_acquire) < target)
+  {
+    wake.notify_one();
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+}
+
+void Logger::shutdown()
+{
+  if (!running.exchange(false))
+    return;
+
+  wake.notify_one();
+  if (writer.joinable())
+  {
+    writer.join();
+  }
+}
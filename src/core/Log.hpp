@@ -0,0 +1,143 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+enum class LogLevel : std::uint8_t
+{
+  Trace = 0, // Per-frame / per-bullet detail
+  Debug,     // Per-entity lifecycle
+  Info,      // Engine and system lifecycle
+  Warn,
+  Error,
+  Off
+};
+
+enum class LogCategory : std::uint8_t
+{
+  Engine,
+  Manager,
+  Blackboard,
+  Input,
+  Movement,
+  Shooting,
+  Physics,
+  Map,
+  Rendering,
+  HUD,
+  Count
+};
+
+// Messages below this level are compiled out entirely (format arguments are
+// not even evaluated). Release builds set it to Info in CMakeLists.txt.
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 0
+#endif
+
+// At level 0 every message is compiled in; testing level >= 0 would only
+// trip -Wtype-limits, so the check is left out altogether
+#if LOG_COMPILE_LEVEL > 0
+#define LOG_COMPILED_IN(levelValue) (static_cast<int>(levelValue) >= LOG_COMPILE_LEVEL)
+#else
+#define LOG_COMPILED_IN(levelValue) true
+#endif
+
+/**
+ * @brief Asynchronous logger.
+ *
+ * write() formats into a fixed-size record inside a lock-free bounded ring
+ * buffer (multi-producer, single-consumer) and returns; a background thread
+ * drains the ring to stdout/stderr in batches. Producers never block on I/O.
+ * If the ring is full the message is dropped and counted instead (warnings
+ * and errors are written through synchronously rather than lost).
+ *
+ * Runtime levels are per category and can be set from the LOG_LEVEL
+ * environment variable, e.g. LOG_LEVEL=debug or LOG_LEVEL=info,physics=trace.
+ */
+class Logger
+{
+public:
+  static Logger &instance();
+
+  bool isEnabled(LogCategory category, LogLevel level) const
+  {
+    return level >= levels[static_cast<std::size_t>(category)].load(std::memory_order_relaxed);
+  }
+
+  void setLevel(LogLevel level);
+  void setLevel(LogCategory category, LogLevel level);
+  void configure(const char *spec); // "level" or "level,category=level,..."
+
+  void write(LogCategory category, LogLevel level, const char *format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+      __attribute__((format(printf, 4, 5)))
+#endif
+      ;
+
+  // Block until everything logged so far has been written
+  void flush();
+
+  // Drain remaining messages and stop the background thread
+  void shutdown();
+
+  std::uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+  ~Logger();
+
+private:
+  Logger();
+
+  static constexpr std::size_t RING_CAPACITY = 4096; // Must be a power of two
+  static constexpr std::size_t MESSAGE_SIZE = 232;
+
+  struct Record
+  {
+    std::uint64_t timestampUs;
+    LogLevel level;
+    LogCategory category;
+    char message[MESSAGE_SIZE];
+  };
+
+  struct Cell
+  {
+    std::atomic<std::size_t> sequence;
+    Record record;
+  };
+
+  std::unique_ptr<Cell[]> ring;
+  alignas(64) std::atomic<std::size_t> enqueuePos{0};
+  alignas(64) std::size_t dequeuePos = 0; // Only touched by the writer thread
+  std::atomic<std::uint64_t> dropped{0};
+  std::atomic<LogLevel> levels[static_cast<std::size_t>(LogCategory::Count)];
+
+  std::thread writer;
+  std::atomic<bool> running{false};
+  std::mutex wakeMutex;
+  std::condition_variable wake;
+  std::atomic<std::size_t> written{0};
+
+  bool enqueue(LogCategory category, LogLevel level, const char *format, va_list args);
+  void writerLoop();
+  std::size_t drain();
+};
+
+#define LOG_AT(levelValue, categoryName, ...)                                                        \
+  do                                                                                                 \
+  {                                                                                                  \
+    if (LOG_COMPILED_IN(levelValue) &&                                                               \
+        Logger::instance().isEnabled(LogCategory::categoryName, levelValue))                         \
+    {                                                                                                \
+      Logger::instance().write(LogCategory::categoryName, levelValue, __VA_ARGS__);                  \
+    }                                                                                                \
+  } while (0)
+
+#define LOG_TRACE(category, ...) LOG_AT(LogLevel::Trace, category, __VA_ARGS__)
+#define LOG_DEBUG(category, ...) LOG_AT(LogLevel::Debug, category, __VA_ARGS__)
+#define LOG_INFO(category, ...) LOG_AT(LogLevel::Info, category, __VA_ARGS__)
+#define LOG_WARN(category, ...) LOG_AT(LogLevel::Warn, category, __VA_ARGS__)
+#define LOG_ERROR(category, ...) LOG_AT(LogLevel::Error, category, __VA_ARGS__)
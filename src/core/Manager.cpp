@@ -1,49 +1,187 @@
 #include "Manager.hpp"
-#include <memory>
-#include <typeindex>
-#include <unordered_map>
+#include "Log.hpp"
 #include <algorithm>
-#include <iostream>
+#include <atomic>
+#include <memory>
 
 // Global component storage
-std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> &getComponentStores()
+std::vector<std::unique_ptr<IComponentPool>> &getComponentPools()
+{
+  static std::vector<std::unique_ptr<IComponentPool>> componentPools;
+  return componentPools;
+}
+
+std::mutex &getComponentPoolsMutex()
+{
+  static std::mutex componentPoolsMutex;
+  return componentPoolsMutex;
+}
+
+ComponentTypeId nextComponentTypeId()
 {
-  static std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> componentStores;
-  return componentStores;
+  // Systems may touch a component type for the first time on a worker thread
+  static std::atomic<ComponentTypeId> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed);
 }
 
-Manager::Manager() {}
-Manager::~Manager() {}
+namespace
+{
+  // Component pools are global, so they check handles against the one live Manager
+  const Manager *currentManager = nullptr;
+}
+
+bool isCurrentEntity(Entity entity)
+{
+  return !currentManager || currentManager->isAlive(entity);
+}
+
+Manager::Manager()
+{
+  records.resize(1); // Reserve index 0 so NULL_ENTITY is never handed out
+  currentManager = this;
+}
+
+Manager::~Manager()
+{
+  if (currentManager == this)
+    currentManager = nullptr;
+}
 
 Entity Manager::createEntity()
 {
-  Entity entity = nextEntityId++;
+  Entity entity = allocateEntity();
+  LOG_DEBUG(Manager, "Created entity %u", entity);
+  return entity;
+}
+
+void Manager::createEntities(std::size_t count, std::vector<Entity> &out)
+{
+  // Grow geometrically so repeated batches stay amortized; records may be
+  // over-reserved when the free list covers part of the batch
+  auto reserveFor = [count](auto &vec)
+  {
+    std::size_t needed = vec.size() + count;
+    if (needed > vec.capacity())
+      vec.reserve(std::max(needed, vec.capacity() * 2));
+  };
+  reserveFor(entities);
+  reserveFor(records);
+  reserveFor(out);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Entity entity = allocateEntity();
+    if (entity == NULL_ENTITY)
+      break;
+    out.push_back(entity);
+  }
+  LOG_DEBUG(Manager, "Created %zu entities", count);
+}
+
+Entity Manager::allocateEntity()
+{
+  std::uint32_t index;
+  if (freeHead != INVALID_INDEX)
+  {
+    // Recycle the oldest free slot; FIFO order spreads reuse across slots so
+    // versions wrap as late as possible
+    index = freeHead;
+    freeHead = records[index].nextFree;
+    if (freeHead == INVALID_INDEX)
+      freeTail = INVALID_INDEX;
+  }
+  else
+  {
+    if (records.size() > ENTITY_INDEX_MASK)
+    {
+      LOG_ERROR(Manager, "Entity limit reached (%u)", ENTITY_INDEX_MASK);
+      return NULL_ENTITY;
+    }
+    index = static_cast<std::uint32_t>(records.size());
+    records.emplace_back();
+  }
+
+  EntityRecord &record = records[index];
+  record.nextFree = INVALID_INDEX;
+  record.denseIndex = static_cast<std::uint32_t>(entities.size());
+
+  Entity entity = makeEntity(index, record.version);
   entities.push_back(entity);
-  std::cout << "[Manager] Created entity " << entity << std::endl;
   return entity;
 }
 
 void Manager::destroyEntity(Entity entity)
 {
-  // Not implemented for prototype
+  // Stale or already-destroyed handles are ignored
+  if (!isAlive(entity))
+    return;
+
+  // Remove all components for this entity
+  auto &componentPools = getComponentPools();
+  for (auto &pool : componentPools)
+  {
+    if (pool)
+      pool->remove(entity);
+  }
+
+  releaseSlot(entity);
+  LOG_DEBUG(Manager, "Destroyed entity %u", entity);
 }
 
-void Manager::removeEntity(Entity entity)
+void Manager::destroyEntities(const std::vector<Entity> &batch)
 {
-  // Remove from entities list
-  entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
+  if (batch.empty())
+    return;
 
-  // Remove all components for this entity
-  auto &componentStores = getComponentStores();
-  for (auto &[typeIndex, entityMap] : componentStores)
+  // Walk pool by pool so each pool's arrays stay hot for the whole batch
+  auto &componentPools = getComponentPools();
+  for (auto &pool : componentPools)
   {
-    entityMap.erase(entity);
+    if (!pool)
+      continue;
+    for (Entity entity : batch)
+    {
+      pool->remove(entity);
+    }
   }
 
-  std::cout << "[Manager] Removed entity " << entity << std::endl;
+  for (Entity entity : batch)
+  {
+    releaseSlot(entity);
+  }
+
+  LOG_DEBUG(Manager, "Destroyed %zu entities", batch.size());
+}
+
+void Manager::releaseSlot(Entity entity)
+{
+  // Swap-remove from the live list
+  std::uint32_t index = entityIndex(entity);
+  EntityRecord &record = records[index];
+  Entity last = entities.back();
+  entities[record.denseIndex] = last;
+  records[entityIndex(last)].denseIndex = record.denseIndex;
+  entities.pop_back();
+
+  // Invalidate outstanding handles and queue the slot for reuse
+  record.version = (record.version + 1) & ENTITY_VERSION_MASK;
+  record.denseIndex = INVALID_INDEX;
+  if (freeTail != INVALID_INDEX)
+    records[freeTail].nextFree = index;
+  else
+    freeHead = index;
+  freeTail = index;
+}
+
+bool Manager::isAlive(Entity entity) const
+{
+  std::uint32_t index = entityIndex(entity);
+  return index != 0 && index < records.size() &&
+         records[index].denseIndex != INVALID_INDEX &&
+         records[index].version == entityVersion(entity);
 }
 
 std::vector<Entity> Manager::getAllEntities() const
 {
   return entities;
-}
\ No newline at end of file
+}
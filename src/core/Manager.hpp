@@ -2,15 +2,18 @@
 #include "Component.hpp"
 #include "Entity.hpp"
 #include "System.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <typeindex>
-#include <unordered_map>
+#include <mutex>
 #include <vector>
-#include <iostream>
 
 /**
  * @brief ECS Manager: Handles entities, components, and systems.
+ *
+ * Entity handles are generational (see Entity.hpp). Destroyed slots go on a
+ * FIFO free list and are recycled with a bumped version, so the handle space
+ * and the live-entity array stay bounded no matter how many bullets are fired.
  */
 class Manager
 {
@@ -18,24 +21,87 @@ public:
   Manager();
   ~Manager();
   Entity createEntity();
+  // Create count entities at once, appending their handles to out; storage is reserved up front
+  void createEntities(std::size_t count, std::vector<Entity> &out);
   void destroyEntity(Entity entity);
-  void removeEntity(Entity entity);
+  void destroyEntities(const std::vector<Entity> &batch); // Entities must be alive and unique
+  bool isAlive(Entity entity) const;
+  std::size_t getEntityCount() const { return entities.size(); }
   std::vector<Entity> getAllEntities() const;
 
-  // Component and system management methods to be implemented
 private:
-  Entity nextEntityId = 1;
-  std::vector<Entity> entities;
-  // Storage for components and systems
+  static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+  struct EntityRecord
+  {
+    std::uint32_t version = 0;
+    std::uint32_t denseIndex = INVALID_INDEX; // Position in entities, INVALID_INDEX while free
+    std::uint32_t nextFree = INVALID_INDEX;   // Free-list link while the slot is unused
+  };
+
+  std::vector<EntityRecord> records; // Indexed by entityIndex(); slot 0 is reserved
+  std::vector<Entity> entities;      // Packed list of live entities
+  std::uint32_t freeHead = INVALID_INDEX;
+  std::uint32_t freeTail = INVALID_INDEX;
+
+  Entity allocateEntity();
+  void releaseSlot(Entity entity);
 };
 
 // --- ECS Component Storage (Header-only for templates) ---
-#include <memory>
-#include <typeindex>
-#include <unordered_map>
+#include "ComponentPool.hpp"
+#include "View.hpp"
+
+using ComponentTypeId = std::size_t;
 
-// Forward declaration
-std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> &getComponentStores();
+// Hands out the next dense component type id (0, 1, 2, ...)
+ComponentTypeId nextComponentTypeId();
+
+/**
+ * @brief Dense small-integer id for a component type, assigned on first use.
+ * Replaces typeid/std::type_index hashing as the key for component storage.
+ */
+template <typename T>
+ComponentTypeId componentTypeId()
+{
+  static const ComponentTypeId id = nextComponentTypeId();
+  return id;
+}
+
+// Global component pools, one sparse set per component type, indexed by componentTypeId
+std::vector<std::unique_ptr<IComponentPool>> &getComponentPools();
+
+// Guards registration, which can happen concurrently from scheduled systems
+std::mutex &getComponentPoolsMutex();
+
+template <typename T>
+ComponentPool<T> *registerComponentPool()
+{
+  std::lock_guard<std::mutex> lock(getComponentPoolsMutex());
+  auto &componentPools = getComponentPools();
+  ComponentTypeId id = componentTypeId<T>();
+  if (componentPools.size() <= id)
+  {
+    componentPools.resize(id + 1);
+  }
+  if (!componentPools[id])
+  {
+    componentPools[id] = std::make_unique<ComponentPool<T>>();
+  }
+  return static_cast<ComponentPool<T> *>(componentPools[id].get());
+}
+
+/**
+ * @brief Get the pool for a component type, creating it on first use. The
+ * pool is resolved once per type and cached in a static, so after the first
+ * call this is a single load with no hashing or RTTI.
+ */
+template <typename T>
+ComponentPool<T> &getComponentPool()
+{
+  static ComponentPool<T> *pool = registerComponentPool<T>();
+  return *pool;
+}
 
 /**
  * @brief Add a component to an entity.
@@ -43,27 +109,43 @@ std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<v
 template <typename T>
 void addComponent(Entity entity, const T &component)
 {
-  getComponentStores()[typeid(T)][entity] = std::make_shared<T>(component);
+  getComponentPool<T>().add(entity, component);
 }
 
 /**
  * @brief Get a pointer to a component of an entity. Returns nullptr if not
- * found.
+ * found. The pointer is invalidated by the next add/remove of a T component.
  */
 template <typename T>
 T *getComponent(Entity entity)
 {
-  auto &componentStores = getComponentStores();
-  auto typeIt = componentStores.find(typeid(T));
-  if (typeIt == componentStores.end())
-  {
-    return nullptr;
-  }
+  return getComponentPool<T>().get(entity);
+}
 
-  auto it = typeIt->second.find(entity);
-  if (it != typeIt->second.end())
-  {
-    return static_cast<T *>(it->second.get());
-  }
-  return nullptr;
-}
\ No newline at end of file
+/**
+ * @brief Reserve room for additional components of type T ahead of a bulk add.
+ */
+template <typename T>
+void reserveComponents(std::size_t additional)
+{
+  getComponentPool<T>().reserveFor(additional);
+}
+
+/**
+ * @brief Remove a component from an entity, if present.
+ */
+template <typename T>
+void removeComponent(Entity entity)
+{
+  getComponentPool<T>().remove(entity);
+}
+
+/**
+ * @brief Query every entity that has all of the given components, e.g.
+ * view<Position, Velocity>().each([](Entity e, Position &pos, Velocity &vel) { ... });
+ */
+template <typename... Ts>
+View<Ts...> view()
+{
+  return View<Ts...>(getComponentPool<Ts>()...);
+}
@@ -0,0 +1,221 @@
+#include "Profiler.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+  std::atomic<std::uint16_t> nextThreadIndex{0};
+}
+
+Profiler &Profiler::instance()
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+Profiler::Profiler()
+    : frames(new Frame[FRAME_CAPACITY]), events(new Event[FRAME_CAPACITY * EVENTS_PER_FRAME])
+{
+}
+
+std::int64_t Profiler::nowNs()
+{
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+std::uint16_t Profiler::threadIndex()
+{
+  // Small stable ids for the trace; the thread that drives frames asks first and gets 0
+  thread_local const std::uint16_t index = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+Profiler::ZoneId Profiler::registerZone(const char *name)
+{
+  std::lock_guard<std::mutex> lock(zoneMutex);
+  const std::size_t count = zoneCount.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (std::strcmp(zoneNames[i], name) == 0)
+      return static_cast<ZoneId>(i);
+  }
+
+  if (count == MAX_ZONES)
+  {
+    LOG_WARN(Engine, "Profiler zone limit reached, '%s' shares the last zone", name);
+    return static_cast<ZoneId>(MAX_ZONES - 1);
+  }
+  zoneNames[count] = name;
+  zoneCount.store(count + 1, std::memory_order_release);
+  return static_cast<ZoneId>(count);
+}
+
+void Profiler::beginFrame()
+{
+  threadIndex();
+  Frame &frame = frames[frameIndex % FRAME_CAPACITY];
+  frame.count.store(0, std::memory_order_relaxed);
+  frame.endNs = 0;
+  frame.startNs = nowNs();
+}
+
+void Profiler::endFrame()
+{
+  frames[frameIndex % FRAME_CAPACITY].endNs = nowNs();
+  ++frameIndex;
+}
+
+void Profiler::record(ZoneId zone, std::int64_t startNs, std::int64_t endNs)
+{
+  if (!active.load(std::memory_order_relaxed))
+    return;
+
+  const std::size_t slot = frameIndex % FRAME_CAPACITY;
+  const std::uint32_t index = frames[slot].count.fetch_add(1, std::memory_order_relaxed);
+  if (index >= EVENTS_PER_FRAME)
+  {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  Event &event = events[slot * EVENTS_PER_FRAME + index];
+  event.startNs = startNs;
+  event.durationNs = static_cast<std::uint32_t>(std::min<std::int64_t>(endNs - startNs, UINT32_MAX));
+  event.zone = zone;
+  event.thread = threadIndex();
+}
+
+void Profiler::computeStats(std::size_t frameWindow, std::vector<ZoneStats> &out) const
+{
+  out.clear();
+  const std::size_t window = static_cast<std::size_t>(
+      std::min<std::uint64_t>({frameWindow, frameIndex, FRAME_CAPACITY - 1}));
+  if (window == 0)
+    return;
+
+  // Zones are summed per frame: several ticks in one frame count as one sample
+  const std::size_t zones = zoneCount.load(std::memory_order_acquire);
+  std::vector<std::vector<double>> samples(zones + 1);
+  std::vector<double> totals(zones);
+  std::vector<bool> ran(zones);
+
+  for (std::uint64_t f = frameIndex - window; f < frameIndex; ++f)
+  {
+    const std::size_t slot = f % FRAME_CAPACITY;
+    const Frame &frame = frames[slot];
+    samples[0].push_back((frame.endNs - frame.startNs) / 1e6);
+
+    std::fill(totals.begin(), totals.end(), 0.0);
+    std::fill(ran.begin(), ran.end(), false);
+    const std::size_t count = std::min<std::size_t>(frame.count.load(std::memory_order_relaxed), EVENTS_PER_FRAME);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const Event &event = events[slot * EVENTS_PER_FRAME + i];
+      if (event.zone < zones)
+      {
+        totals[event.zone] += event.durationNs / 1e6;
+        ran[event.zone] = true;
+      }
+    }
+    for (std::size_t zone = 0; zone < zones; ++zone)
+    {
+      if (ran[zone])
+        samples[zone + 1].push_back(totals[zone]);
+    }
+  }
+
+  for (std::size_t i = 0; i < samples.size(); ++i)
+  {
+    std::vector<double> &values = samples[i];
+    if (values.empty())
+      continue;
+
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (double value : values)
+      sum += value;
+    const std::size_t p99 = static_cast<std::size_t>(std::ceil(values.size() * 0.99)) - 1;
+    out.push_back({i == 0 ? "Frame" : zoneNames[i - 1], values.front(), sum / values.size(), values[p99],
+                   values.size()});
+  }
+}
+
+bool Profiler::writeChromeTrace(const std::string &path, double seconds) const
+{
+  if (frameIndex == 0)
+  {
+    LOG_WARN(Engine, "No profiled frames to write");
+    return false;
+  }
+
+  // Walk back from the newest finished frame until the window is covered
+  const std::uint64_t available = std::min<std::uint64_t>(frameIndex, FRAME_CAPACITY - 1);
+  const std::int64_t lastEndNs = frames[(frameIndex - 1) % FRAME_CAPACITY].endNs;
+  const std::int64_t cutoffNs = lastEndNs - static_cast<std::int64_t>(seconds * 1e9);
+  std::uint64_t first = frameIndex - 1;
+  while (first > frameIndex - available && frames[(first - 1) % FRAME_CAPACITY].startNs >= cutoffNs)
+  {
+    --first;
+  }
+
+  std::FILE *file = std::fopen(path.c_str(), "w");
+  if (!file)
+  {
+    LOG_ERROR(Engine, "Failed to open trace file for writing: %s", path.c_str());
+    return false;
+  }
+
+  // Timestamps are microseconds from the first exported frame
+  const std::int64_t originNs = frames[first % FRAME_CAPACITY].startNs;
+  const std::size_t zones = zoneCount.load(std::memory_order_acquire);
+  std::uint16_t threads = 1;
+
+  std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+  std::size_t written = 0;
+  for (std::uint64_t f = first; f < frameIndex; ++f)
+  {
+    const std::size_t slot = f % FRAME_CAPACITY;
+    const Frame &frame = frames[slot];
+    std::fprintf(file,
+                 "{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+                 "\"args\":{\"frame\":%" PRIu64 "}},\n",
+                 (frame.startNs - originNs) / 1e3, (frame.endNs - frame.startNs) / 1e3, f);
+
+    const std::size_t count = std::min<std::size_t>(frame.count.load(std::memory_order_relaxed), EVENTS_PER_FRAME);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const Event &event = events[slot * EVENTS_PER_FRAME + i];
+      if (event.zone >= zones)
+        continue;
+      threads = std::max<std::uint16_t>(threads, event.thread + 1);
+      std::fprintf(file,
+                   "{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f},\n",
+                   zoneNames[event.zone], static_cast<unsigned>(event.thread), (event.startNs - originNs) / 1e3,
+                   event.durationNs / 1e3);
+      ++written;
+    }
+  }
+
+  // Thread names close the array, so no event line needs a trailing-comma check
+  for (std::uint16_t thread = 0; thread < threads; ++thread)
+  {
+    char name[32];
+    if (thread == 0)
+      std::snprintf(name, sizeof(name), "main");
+    else
+      std::snprintf(name, sizeof(name), "worker %u", static_cast<unsigned>(thread));
+    std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}%s\n",
+                 static_cast<unsigned>(thread), name, thread + 1 < threads ? "," : "");
+  }
+  std::fputs("]}\n", file);
+
+  const bool ok = std::fclose(file) == 0;
+  LOG_INFO(Engine, "Wrote %" PRIu64 " frames (%zu zones) to %s", frameIndex - first, written, path.c_str());
+  return ok;
+}
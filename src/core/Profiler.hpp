@@ -0,0 +1,144 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Set to 0 to compile every PROFILE_ZONE out (see ENABLE_PROFILER in CMakeLists.txt)
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+/**
+ * @brief Frame profiler: named timing zones recorded into a ring of frames.
+ *
+ * PROFILE_ZONE("name") times the rest of the enclosing scope. Each frame owns
+ * a fixed block of event slots that zones claim with one atomic increment, so
+ * recording takes no lock and never allocates, and zones may close on any
+ * thread (systems run on the thread pool). Zones that close when the block
+ * is full are counted as dropped. The ring keeps the last FRAME_CAPACITY
+ * frames; a slot is only reused when the frame wraps around.
+ *
+ * The frame boundaries are set by the engine's main loop (beginFrame /
+ * endFrame), and every zone must close before endFrame(); the scheduler and
+ * the physics step both join their workers before returning, so they do.
+ * Statistics and trace exports read finished frames only and are meant to
+ * be called from the main thread between frames.
+ */
+class Profiler
+{
+public:
+  using ZoneId = std::uint16_t;
+
+  static constexpr std::size_t FRAME_CAPACITY = 1024;   // Frames kept (17 s at 60 fps)
+  static constexpr std::size_t EVENTS_PER_FRAME = 256;  // Zone slots per frame
+
+  /** @brief Per-zone timing over a window of frames, in milliseconds per frame. */
+  struct ZoneStats
+  {
+    const char *name;
+    double minMs;
+    double avgMs;
+    double p99Ms;
+    std::size_t frames; // Frames in the window in which the zone ran
+  };
+
+  static Profiler &instance();
+
+  // Zone names must outlive the profiler (string literals); ids are stable
+  ZoneId registerZone(const char *name);
+
+  void setEnabled(bool enabled) { active.store(enabled, std::memory_order_relaxed); }
+  bool isEnabled() const { return active.load(std::memory_order_relaxed); }
+
+  void beginFrame();
+  void endFrame();
+
+  void record(ZoneId zone, std::int64_t startNs, std::int64_t endNs);
+
+  /**
+   * @brief Frame time and every zone's per-frame total over the last
+   * frameWindow finished frames. The first entry is the whole frame.
+   */
+  void computeStats(std::size_t frameWindow, std::vector<ZoneStats> &out) const;
+
+  /**
+   * @brief Write the finished frames of the last `seconds` as a Chrome trace
+   * (chrome://tracing, ui.perfetto.dev): one complete event per zone and
+   * per frame, on the thread that ran it.
+   */
+  bool writeChromeTrace(const std::string &path, double seconds) const;
+
+  std::uint64_t getFrameCount() const { return frameIndex; }
+  std::uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+  static std::int64_t nowNs();
+
+private:
+  Profiler();
+
+  static constexpr std::size_t MAX_ZONES = 64;
+
+  struct Event
+  {
+    std::int64_t startNs;
+    std::uint32_t durationNs;
+    ZoneId zone;
+    std::uint16_t thread;
+  };
+
+  struct Frame
+  {
+    std::int64_t startNs = 0;
+    std::int64_t endNs = 0;
+    std::atomic<std::uint32_t> count{0};
+  };
+
+  std::unique_ptr<Frame[]> frames;
+  std::unique_ptr<Event[]> events; // FRAME_CAPACITY blocks of EVENTS_PER_FRAME
+  std::uint64_t frameIndex = 0;    // Frame being recorded; the ones before it are finished
+  std::atomic<bool> active{true};
+  std::atomic<std::uint64_t> dropped{0};
+
+  std::mutex zoneMutex;
+  const char *zoneNames[MAX_ZONES] = {};
+  std::atomic<std::size_t> zoneCount{0};
+
+  static std::uint16_t threadIndex();
+};
+
+/**
+ * @brief Times its own lifetime as one zone event.
+ */
+class ProfileZone
+{
+public:
+  explicit ProfileZone(Profiler::ZoneId zoneId) : zone(zoneId), startNs(Profiler::nowNs()) {}
+  ~ProfileZone() { Profiler::instance().record(zone, startNs, Profiler::nowNs()); }
+
+  ProfileZone(const ProfileZone &) = delete;
+  ProfileZone &operator=(const ProfileZone &) = delete;
+
+private:
+  Profiler::ZoneId zone;
+  std::int64_t startNs;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+// The zone id is looked up once per call site, then it is two clock reads and an atomic increment
+#define PROFILE_ZONE(name)                                                                           \
+  static const Profiler::ZoneId PROFILE_CONCAT(profileZoneId_, __LINE__) =                           \
+      Profiler::instance().registerZone(name);                                                       \
+  ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(PROFILE_CONCAT(profileZoneId_, __LINE__))
+#else
+#define PROFILE_ZONE(name) \
+  do                       \
+  {                        \
+  } while (0)
+#endif
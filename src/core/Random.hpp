@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Small seeded random number generator (PCG32) for gameplay.
+ *
+ * The engine owns one instance seeded from the config (see
+ * EngineConfig::seed), so a deterministic run draws exactly the same
+ * sequence every time. Not thread-safe: draw from one thread at a time.
+ */
+class Random
+{
+public:
+  explicit Random(std::uint64_t seed = 1) { reseed(seed); }
+
+  void reseed(std::uint64_t seed)
+  {
+    state = 0;
+    next();
+    state += seed;
+    next();
+  }
+
+  std::uint32_t next()
+  {
+    std::uint64_t old = state;
+    state = old * 6364136223846793005ULL + INCREMENT;
+    std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+    std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59u);
+    return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+  }
+
+  // Uniform in [0, 1)
+  float nextFloat() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+
+  // Uniform in [min, max)
+  float range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+  // Uniform in [min, max] (tiny modulo bias is fine for gameplay)
+  int range(int min, int max)
+  {
+    std::uint32_t span = static_cast<std::uint32_t>(max - min) + 1u;
+    return min + static_cast<int>(span == 0 ? next() : next() % span);
+  }
+
+private:
+  static constexpr std::uint64_t INCREMENT = 1442695040888963407ULL; // Any odd constant selects the stream
+  std::uint64_t state = 0;
+};
@@ -0,0 +1,81 @@
+#include "ReplayLog.hpp"
+#include "Log.hpp"
+#include <cinttypes>
+#include <cstdio>
+
+namespace
+{
+  const char *HEADER = "replay-v1";
+}
+
+bool ReplayLog::openRecord(const std::string &path, std::uint32_t recordSeed, int recordTickRate)
+{
+  out.open(path, std::ios::trunc);
+  if (!out.is_open())
+  {
+    LOG_ERROR(Engine, "Failed to open replay file for writing: %s", path.c_str());
+    return false;
+  }
+
+  mode = Mode::Record;
+  seed = recordSeed;
+  tickRate = recordTickRate;
+  out << HEADER << ' ' << seed << ' ' << tickRate << '\n';
+  LOG_INFO(Engine, "Recording replay to %s (seed %u)", path.c_str(), seed);
+  return true;
+}
+
+bool ReplayLog::openVerify(const std::string &path)
+{
+  std::ifstream in(path);
+  std::string header;
+  if (!in.is_open() || !(in >> header >> seed >> tickRate) || header != HEADER)
+  {
+    LOG_ERROR(Engine, "Failed to read replay file: %s", path.c_str());
+    return false;
+  }
+
+  entries.clear();
+  std::uint64_t tick;
+  std::uint32_t keys;
+  std::string hashText;
+  while (in >> tick >> keys >> hashText)
+  {
+    entries.push_back({keys, std::stoull(hashText, nullptr, 16)});
+  }
+
+  mode = Mode::Verify;
+  cursor = 0;
+  LOG_INFO(Engine, "Verifying against %s (%zu ticks, seed %u)", path.c_str(), entries.size(), seed);
+  return true;
+}
+
+void ReplayLog::record(std::uint64_t tick, std::uint32_t keys, std::uint64_t hash)
+{
+  char line[64];
+  std::snprintf(line, sizeof(line), "%" PRIu64 " %u %016" PRIx64 "\n", tick, keys, hash);
+  out << line;
+}
+
+bool ReplayLog::nextKeys(std::uint32_t &keys) const
+{
+  if (cursor >= entries.size())
+    return false;
+  keys = entries[cursor].keys;
+  return true;
+}
+
+bool ReplayLog::verify(std::uint64_t tick, std::uint64_t hash)
+{
+  if (cursor >= entries.size())
+    return true;
+
+  std::uint64_t expected = entries[cursor++].hash;
+  if (hash != expected)
+  {
+    LOG_ERROR(Engine, "Replay diverged at tick %" PRIu64 ": expected %016" PRIx64 ", got %016" PRIx64, tick, expected,
+              hash);
+    return false;
+  }
+  return true;
+}
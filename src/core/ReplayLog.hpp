@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Per-tick input and state-hash log for comparing two deterministic
+ * runs.
+ *
+ * Record mode writes the seed and tick rate, then one line per tick with the
+ * keys held during that tick and the world-state hash after it. Verify mode
+ * loads such a file, feeds the recorded keys back in tick by tick and
+ * reports the first tick whose hash differs from the recording.
+ */
+class ReplayLog
+{
+public:
+  enum class Mode
+  {
+    Off,
+    Record,
+    Verify
+  };
+
+  bool openRecord(const std::string &path, std::uint32_t seed, int tickRate);
+  bool openVerify(const std::string &path);
+
+  Mode getMode() const { return mode; }
+  bool isRecording() const { return mode == Mode::Record; }
+  bool isVerifying() const { return mode == Mode::Verify; }
+
+  // Settings the recording was made with (valid after openVerify)
+  std::uint32_t getSeed() const { return seed; }
+  int getTickRate() const { return tickRate; }
+  std::size_t getTickCount() const { return entries.size(); }
+
+  // Record mode: append one tick
+  void record(std::uint64_t tick, std::uint32_t keys, std::uint64_t hash);
+
+  // Verify mode: keys for the next tick; false once the recording is used up
+  bool nextKeys(std::uint32_t &keys) const;
+
+  // Verify mode: compare this tick's hash; logs and returns false on the first mismatch
+  bool verify(std::uint64_t tick, std::uint64_t hash);
+
+private:
+  struct Entry
+  {
+    std::uint32_t keys;
+    std::uint64_t hash;
+  };
+
+  Mode mode = Mode::Off;
+  std::uint32_t seed = 0;
+  int tickRate = 0;
+  std::ofstream out;
+  std::vector<Entry> entries; // Verify mode: the recording, indexed by tick - 1
+  std::size_t cursor = 0;     // Verify mode: next entry to check
+};
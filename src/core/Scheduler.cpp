@@ -0,0 +1,214 @@
+#include "Scheduler.hpp"
+#include "Log.hpp"
+#include "Profiler.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <string>
+
+namespace
+{
+  // Same clock as the profiler, so zone times can be passed straight through
+  std::int64_t nowNs()
+  {
+    return Profiler::nowNs();
+  }
+}
+
+Scheduler::Scheduler(ThreadPool *threadPool) : pool(threadPool)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::addSystem(System *system, const char *name)
+{
+  Node node;
+  node.system = system;
+  node.name = name;
+  node.zone = Profiler::instance().registerZone(name);
+  system->declareAccess(node.access);
+  nodes.push_back(std::move(node));
+  graphDirty = true;
+}
+
+void Scheduler::clear()
+{
+  nodes.clear();
+  graphDirty = true;
+}
+
+void Scheduler::buildGraph()
+{
+  // Edge j -> i for every earlier system j that conflicts with i. Redundant
+  // transitive edges are harmless, and there are only a handful of systems.
+  for (Node &node : nodes)
+  {
+    node.dependents.clear();
+    node.dependencyCount = 0;
+    node.stage = 0;
+  }
+
+  stageCount = nodes.empty() ? 0 : 1;
+  for (std::size_t i = 0; i < nodes.size(); ++i)
+  {
+    for (std::size_t j = 0; j < i; ++j)
+    {
+      if (nodes[j].access.conflictsWith(nodes[i].access))
+      {
+        nodes[j].dependents.push_back(i);
+        nodes[i].dependencyCount++;
+        nodes[i].stage = std::max(nodes[i].stage, nodes[j].stage + 1);
+      }
+    }
+    stageCount = std::max(stageCount, nodes[i].stage + 1);
+  }
+
+  pending.reset(new std::atomic<std::size_t>[nodes.size()]);
+  stageUs.assign(stageCount, 0.0);
+  stageStart.resize(stageCount);
+  stageEnd.resize(stageCount);
+  graphDirty = false;
+
+  for (std::size_t stage = 0; stage < stageCount; ++stage)
+  {
+    std::string names;
+    for (const Node &node : nodes)
+    {
+      if (node.stage == stage)
+      {
+        names += names.empty() ? node.name : std::string(", ") + node.name;
+      }
+    }
+    LOG_INFO(Engine, "Scheduler stage %zu: %s", stage, names.c_str());
+  }
+}
+
+void Scheduler::run(float dt)
+{
+  if (graphDirty)
+  {
+    buildGraph();
+  }
+  if (nodes.empty())
+    return;
+
+  frameDt = dt;
+  frameStartNs = nowNs();
+
+  if (!isParallel())
+  {
+    for (Node &node : nodes)
+    {
+      runNode(node);
+    }
+  }
+  else
+  {
+    remaining.store(nodes.size(), std::memory_order_relaxed);
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+      pending[i].store(nodes[i].dependencyCount, std::memory_order_relaxed);
+    }
+
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+      if (nodes[i].dependencyCount == 0)
+      {
+        pool->submit([this, i]() { execute(i); });
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(doneMutex);
+    done.wait(lock, [this]() { return remaining.load(std::memory_order_acquire) == 0; });
+  }
+
+  accumulateFrame();
+}
+
+void Scheduler::execute(std::size_t index)
+{
+  Node &node = nodes[index];
+  runNode(node);
+
+  for (std::size_t dependent : node.dependents)
+  {
+    if (pending[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      pool->submit([this, dependent]() { execute(dependent); });
+    }
+  }
+
+  if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    std::lock_guard<std::mutex> lock(doneMutex);
+    done.notify_one();
+  }
+}
+
+void Scheduler::runNode(Node &node)
+{
+  const std::int64_t startNs = nowNs();
+  node.system->update(frameDt);
+  const std::int64_t endNs = nowNs();
+
+  node.startNs = startNs - frameStartNs;
+  node.endNs = endNs - frameStartNs;
+#if PROFILER_ENABLED
+  Profiler::instance().record(node.zone, startNs, endNs);
+#endif
+}
+
+void Scheduler::accumulateFrame()
+{
+  std::int64_t frameEnd = 0;
+  std::fill(stageStart.begin(), stageStart.end(), INT64_MAX);
+  std::fill(stageEnd.begin(), stageEnd.end(), 0);
+
+  for (Node &node : nodes)
+  {
+    double us = (node.endNs - node.startNs) / 1000.0;
+    node.totalUs += us;
+    busyUs += us;
+    frameEnd = std::max(frameEnd, node.endNs);
+    stageStart[node.stage] = std::min(stageStart[node.stage], node.startNs);
+    stageEnd[node.stage] = std::max(stageEnd[node.stage], node.endNs);
+  }
+
+  for (std::size_t stage = 0; stage < stageCount; ++stage)
+  {
+    stageUs[stage] += (stageEnd[stage] - stageStart[stage]) / 1000.0;
+  }
+  frameUs += frameEnd / 1000.0;
+
+  if (++frames >= REPORT_INTERVAL)
+  {
+    report();
+  }
+}
+
+void Scheduler::report()
+{
+  if (frames == 0)
+    return;
+
+  // Overlap: total system time over wall time (1.0 = fully serial)
+  LOG_DEBUG(Engine, "Scheduler (%s): %llu frames, update %.1f us/frame, overlap %.2fx",
+            isParallel() ? "parallel" : "serial", static_cast<unsigned long long>(frames),
+            frameUs / frames, frameUs > 0.0 ? busyUs / frameUs : 1.0);
+
+  for (std::size_t stage = 0; stage < stageCount; ++stage)
+  {
+    LOG_DEBUG(Engine, "  stage %zu: %.1f us/frame", stage, stageUs[stage] / frames);
+    stageUs[stage] = 0.0;
+  }
+
+  for (Node &node : nodes)
+  {
+    LOG_DEBUG(Engine, "  %-16s stage %zu: %.1f us/frame", node.name, node.stage, node.totalUs / frames);
+    node.totalUs = 0.0;
+  }
+
+  frames = 0;
+  frameUs = 0.0;
+  busyUs = 0.0;
+}
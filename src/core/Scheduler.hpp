@@ -0,0 +1,95 @@
+#pragma once
+#include "System.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * @brief Runs the systems' update() for one frame, in parallel where their
+ * declared access (System::declareAccess) allows it.
+ *
+ * Systems are added in the same order the engine used to call them. A system
+ * depends on every earlier system it conflicts with, so any two systems that
+ * touch the same data still run in registration order and the result matches
+ * a serial update exactly; only non-conflicting systems overlap. The graph is
+ * rebuilt whenever the system list changes.
+ *
+ * Per-system and per-stage timings are accumulated and logged (Engine, debug
+ * level) every REPORT_INTERVAL frames. A stage is the set of systems at the
+ * same depth of the dependency graph. Each update is also recorded as a
+ * Profiler zone named after the system.
+ */
+class Scheduler
+{
+public:
+  explicit Scheduler(ThreadPool *pool = nullptr); // nullptr runs everything on the calling thread
+  ~Scheduler();
+
+  void setThreadPool(ThreadPool *threadPool) { pool = threadPool; }
+
+  void addSystem(System *system, const char *name);
+  void clear();
+
+  // Serial mode runs systems one by one in registration order (for comparison/debugging)
+  void setParallel(bool enabled) { parallel = enabled; }
+  bool isParallel() const { return parallel && pool; }
+
+  void run(float dt);
+
+  // Log accumulated timings and reset them
+  void report();
+
+  std::size_t getStageCount() const { return stageCount; }
+
+private:
+  static constexpr std::uint64_t REPORT_INTERVAL = 600; // Frames
+
+  struct Node
+  {
+    System *system;
+    const char *name;
+    std::uint16_t zone; // Profiler zone id
+    SystemAccess access;
+    std::vector<std::size_t> dependents;
+    std::size_t dependencyCount = 0;
+    std::size_t stage = 0;
+
+    // Filled by whichever thread ran the node, read after the frame completes
+    std::int64_t startNs = 0;
+    std::int64_t endNs = 0;
+    double totalUs = 0.0;
+  };
+
+  ThreadPool *pool;
+  bool parallel = true;
+  std::vector<Node> nodes;
+  std::size_t stageCount = 0;
+  bool graphDirty = true;
+
+  // Per-frame execution state
+  std::unique_ptr<std::atomic<std::size_t>[]> pending;
+  std::atomic<std::size_t> remaining{0};
+  std::mutex doneMutex;
+  std::condition_variable done;
+  std::int64_t frameStartNs = 0;
+  float frameDt = 0.0f;
+  std::vector<std::int64_t> stageStart; // Per-stage span of the frame, sized in buildGraph()
+  std::vector<std::int64_t> stageEnd;
+
+  // Accumulated statistics since the last report
+  std::uint64_t frames = 0;
+  double frameUs = 0.0;
+  double busyUs = 0.0;
+  std::vector<double> stageUs;
+
+  void buildGraph();
+  void execute(std::size_t index);
+  void runNode(Node &node);
+  void accumulateFrame();
+};
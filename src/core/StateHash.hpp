@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief 64-bit FNV-1a over raw bytes, used to fingerprint the simulation
+ * state each tick in deterministic mode. Floats are hashed by bit pattern,
+ * so two runs only match if they are bit-identical.
+ */
+class StateHash
+{
+public:
+  void add(const void *data, std::size_t size)
+  {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      hash = (hash ^ bytes[i]) * PRIME;
+    }
+  }
+
+  // Only for types without padding, or the padding bytes end up in the hash
+  template <typename T>
+  void add(const T &value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "hash plain data only");
+    add(&value, sizeof(T));
+  }
+
+  std::uint64_t value() const { return hash; }
+
+private:
+  static constexpr std::uint64_t OFFSET_BASIS = 14695981039346656037ULL;
+  static constexpr std::uint64_t PRIME = 1099511628211ULL;
+  std::uint64_t hash = OFFSET_BASIS;
+};
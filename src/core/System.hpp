@@ -1,9 +1,13 @@
 #pragma once
 #include "Entity.hpp"
 #include "Blackboard.hpp"
+#include "Events.hpp"
+#include "SystemAccess.hpp"
 #include <cstdint>
 #include <vector>
 
+class CommandBuffer;
+
 /**
  * @brief Base class for ECS systems. Override update() in derived systems.
  */
@@ -13,11 +17,32 @@ public:
   virtual ~System() = default;
   virtual void update(float dt) = 0;
 
+  /**
+   * @brief Declare what update() reads and writes so the Scheduler can run
+   * non-conflicting systems in parallel. Systems that don't override this
+   * are treated as exclusive and never overlap with anything.
+   */
+  virtual void declareAccess(SystemAccess &access) const { access.exclusive(); }
+
+  /**
+   * @brief Called after the end-of-tick flush with every entity it destroyed
+   * (sorted), so systems can drop their own references in one pass.
+   */
+  virtual void onEntitiesDestroyed(const std::vector<Entity> & /*destroyed*/) {}
+
   // Set blackboard reference for inter-system communication
   void setBlackboard(Blackboard *bb) { blackboard = bb; }
 
+  // Set typed event channels for per-frame inter-system messages
+  void setEvents(Events *ev) { events = ev; }
+
+  // Set command buffer for deferred entity/component changes
+  void setCommandBuffer(CommandBuffer *cb) { commands = cb; }
+
   std::vector<Entity> entities;
 
 protected:
   Blackboard *blackboard = nullptr;
+  Events *events = nullptr;
+  CommandBuffer *commands = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+/**
+ * @brief What a system touches during update(): the component types,
+ * event channels and shared resources (Manager, CommandBuffer, Blackboard)
+ * it reads and writes. The Scheduler runs two systems concurrently only if
+ * neither writes something the other reads or writes.
+ *
+ * Resources are identified by type, e.g.
+ * access.read<Input, MovementEvent>().write<Velocity>();
+ */
+class SystemAccess
+{
+public:
+  template <typename... Ts>
+  SystemAccess &read()
+  {
+    (insert(reads, resourceTag<Ts>()), ...);
+    return *this;
+  }
+
+  template <typename... Ts>
+  SystemAccess &write()
+  {
+    (insert(writes, resourceTag<Ts>()), ...);
+    return *this;
+  }
+
+  // Conflicts with every other system (the default for undeclared systems)
+  SystemAccess &exclusive()
+  {
+    isExclusive = true;
+    return *this;
+  }
+
+  bool conflictsWith(const SystemAccess &other) const
+  {
+    return isExclusive || other.isExclusive ||
+           intersects(writes, other.writes) ||
+           intersects(writes, other.reads) ||
+           intersects(reads, other.writes);
+  }
+
+private:
+  using Tag = const void *;
+
+  std::vector<Tag> reads;  // Sorted
+  std::vector<Tag> writes; // Sorted
+  bool isExclusive = false;
+
+  template <typename T>
+  static Tag resourceTag()
+  {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  static void insert(std::vector<Tag> &tags, Tag tag)
+  {
+    auto it = std::lower_bound(tags.begin(), tags.end(), tag, std::less<Tag>());
+    if (it == tags.end() || *it != tag)
+    {
+      tags.insert(it, tag);
+    }
+  }
+
+  static bool intersects(const std::vector<Tag> &a, const std::vector<Tag> &b)
+  {
+    auto i = a.begin();
+    auto j = b.begin();
+    while (i != a.end() && j != b.end())
+    {
+      if (*i == *j)
+        return true;
+      if (std::less<Tag>()(*i, *j))
+        ++i;
+      else
+        ++j;
+    }
+    return false;
+  }
+};
@@ -0,0 +1,138 @@
+#include "ThreadPool.hpp"
+#include "Log.hpp"
+#include <algorithm>
+
+namespace
+{
+  // Slot of the current thread within its pool; workers set it on start-up
+  thread_local const ThreadPool *currentPool = nullptr;
+  thread_local std::size_t currentWorkerIndex = 0;
+}
+
+ThreadPool::ThreadPool(std::size_t workerCount)
+{
+  if (workerCount == 0)
+  {
+    unsigned int cores = std::thread::hardware_concurrency();
+    workerCount = cores > 1 ? cores - 1 : 1;
+  }
+
+  workers.reserve(workerCount);
+  for (std::size_t i = 0; i < workerCount; ++i)
+  {
+    workers.emplace_back(&ThreadPool::workerLoop, this, i);
+  }
+  LOG_INFO(Engine, "Thread pool started with %zu workers", workerCount);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  available.notify_all();
+
+  for (std::thread &worker : workers)
+  {
+    worker.join();
+  }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+  available.notify_one();
+}
+
+void ThreadPool::workerLoop(std::size_t index)
+{
+  currentPool = this;
+  currentWorkerIndex = index;
+
+  for (;;)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+      if (tasks.empty())
+        return; // Stopping and drained
+
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+    task();
+  }
+}
+
+std::size_t ThreadPool::currentSlot() const
+{
+  // Workers use their own index; any other thread (e.g. the main thread)
+  // gets the extra slot past the last worker. A worker waiting in wait() is
+  // not running anything else, so reusing its index stays unique.
+  return currentPool == this ? currentWorkerIndex : workers.size();
+}
+
+std::shared_ptr<ThreadPool::RangeTask> ThreadPool::parallelFor(int count, int minRange, RangeTask::Body body)
+{
+  auto task = std::make_shared<RangeTask>();
+  task->body = std::move(body);
+  task->count = count;
+  if (count <= 0)
+    return task; // No chunks: wait() returns immediately
+
+  // About one chunk per thread, but never smaller than minRange
+  int threads = static_cast<int>(getConcurrency());
+  int chunks = std::max(1, std::min(threads, count / std::max(1, minRange)));
+  task->chunkSize = (count + chunks - 1) / chunks;
+  task->chunkCount = (count + task->chunkSize - 1) / task->chunkSize;
+
+  // One helper per chunk, dispatched now: callers such as Box2D's solver
+  // need the chunks running concurrently, not only once wait() is reached.
+  // wait() still helps with whatever nobody has claimed yet.
+  for (int i = 0; i < task->chunkCount; ++i)
+  {
+    submit(
+        [this, task]()
+        {
+          std::size_t slot = currentSlot();
+          while (task->runOneChunk(slot))
+          {
+          }
+        });
+  }
+  return task;
+}
+
+void ThreadPool::wait(RangeTask &task)
+{
+  std::size_t slot = currentSlot();
+  while (task.runOneChunk(slot))
+  {
+  }
+
+  std::unique_lock<std::mutex> lock(task.doneMutex);
+  task.done.wait(lock, [&task]() { return task.chunksDone.load(std::memory_order_acquire) == task.chunkCount; });
+}
+
+bool ThreadPool::RangeTask::runOneChunk(std::size_t slot)
+{
+  int chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+  if (chunk >= chunkCount)
+    return false;
+
+  int begin = chunk * chunkSize;
+  int end = std::min(count, begin + chunkSize);
+  body(begin, end, slot);
+
+  if (chunksDone.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount)
+  {
+    std::lock_guard<std::mutex> lock(doneMutex);
+    done.notify_all();
+  }
+  return true;
+}
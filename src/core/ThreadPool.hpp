@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads pulling tasks from a shared FIFO queue.
+ * Created once by the engine and shared by everything that wants to fan work
+ * out across cores.
+ */
+class ThreadPool
+{
+public:
+  // workerCount == 0 picks hardware_concurrency() - 1 (the main thread is the last core)
+  explicit ThreadPool(std::size_t workerCount = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  std::size_t getWorkerCount() const { return workers.size(); }
+
+  // Threads that can run range chunks at once: the workers plus the waiting caller
+  std::size_t getConcurrency() const { return workers.size() + 1; }
+
+  void submit(std::function<void()> task);
+
+  /**
+   * @brief A range [0, count) split into chunks that workers claim one at a
+   * time. Each chunk gets a slot index in [0, getConcurrency()) that is unique
+   * among the chunks running at the same moment (Box2D relies on this for its
+   * per-worker scratch memory).
+   */
+  class RangeTask
+  {
+  public:
+    using Body = std::function<void(int begin, int end, std::size_t slot)>;
+
+  private:
+    friend class ThreadPool;
+
+    Body body;
+    int count = 0;
+    int chunkSize = 1;
+    int chunkCount = 0;
+    std::atomic<int> nextChunk{0};
+    std::atomic<int> chunksDone{0};
+    std::mutex doneMutex;
+    std::condition_variable done;
+
+    bool runOneChunk(std::size_t slot); // False once every chunk has been claimed
+  };
+
+  // Start running body over [0, count) in chunks of at least minRange items
+  std::shared_ptr<RangeTask> parallelFor(int count, int minRange, RangeTask::Body body);
+
+  // Help with the remaining chunks on the calling thread, then wait for the rest
+  void wait(RangeTask &task);
+
+private:
+  std::vector<std::thread> workers;
+  std::deque<std::function<void()>> tasks;
+  std::mutex mutex;
+  std::condition_variable available;
+  bool stopping = false;
+
+  void workerLoop(std::size_t index);
+  std::size_t currentSlot() const;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include "ComponentPool.hpp"
+#include "Entity.hpp"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Iterates the entities that own every component in Ts.
+ *
+ * Iteration is driven by the smallest of the requested pools, so the number
+ * of probes is bounded by the rarest component rather than by a hand-kept
+ * entity list. Callbacks receive direct references into the pools.
+ *
+ * Do not add or remove components of the viewed types from inside each();
+ * the packed arrays being walked would shift underneath the loop.
+ */
+template <typename... Ts>
+class View
+{
+public:
+  explicit View(ComponentPool<Ts> &...pools) : pools(&pools...) {}
+
+  /**
+   * @brief Call func(entity, Ts &...) for every entity that has all of Ts.
+   */
+  template <typename Func>
+  void each(Func &&func)
+  {
+    const std::vector<Entity> &driver = smallestPoolEntities();
+    for (std::size_t i = 0; i < driver.size(); ++i)
+    {
+      Entity entity = driver[i];
+      std::tuple<Ts *...> components(std::get<ComponentPool<Ts> *>(pools)->get(entity)...);
+      if ((std::get<Ts *>(components) && ...))
+      {
+        func(entity, *std::get<Ts *>(components)...);
+      }
+    }
+  }
+
+  /**
+   * @brief Upper bound on the number of entities each() will visit.
+   */
+  std::size_t sizeHint() const { return smallestPoolEntities().size(); }
+
+private:
+  std::tuple<ComponentPool<Ts> *...> pools;
+
+  const std::vector<Entity> &smallestPoolEntities() const
+  {
+    const std::vector<Entity> *smallest = nullptr;
+    ((smallest = (!smallest || std::get<ComponentPool<Ts> *>(pools)->size() < smallest->size())
+                     ? &std::get<ComponentPool<Ts> *>(pools)->entities()
+                     : smallest),
+     ...);
+    return *smallest;
+  }
+};
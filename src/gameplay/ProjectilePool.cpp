@@ -0,0 +1,113 @@
+#include "ProjectilePool.hpp"
+#include <algorithm>
+
+namespace
+{
+    // One pass moves, ages and flags every projectile. It has no branches and
+    // does no removal, and __restrict tells the compiler the arrays don't
+    // overlap, so it can vectorize the loop without runtime alias checks.
+    void advanceAndFlag(std::size_t count, float dt, float minX, float minY, float maxX, float maxY,
+                        float *__restrict posX, float *__restrict posY, float *__restrict startX,
+                        float *__restrict startY, const float *__restrict velX, const float *__restrict velY,
+                        float *__restrict age, const float *__restrict maxAge, std::uint8_t *__restrict flags)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float nextX = posX[i] + velX[i] * dt;
+            float nextY = posY[i] + velY[i] * dt;
+            float nextAge = age[i] + dt;
+
+            startX[i] = posX[i];
+            startY[i] = posY[i];
+            posX[i] = nextX;
+            posY[i] = nextY;
+            age[i] = nextAge;
+
+            flags[i] = static_cast<std::uint8_t>((nextAge >= maxAge[i]) | (nextX < minX) | (nextX > maxX) |
+                                                 (nextY < minY) | (nextY > maxY));
+        }
+    }
+}
+
+void ProjectilePool::spawn(float px, float py, float pvx, float pvy, float plifetime)
+{
+    x.push_back(px);
+    y.push_back(py);
+    prevX.push_back(px);
+    prevY.push_back(py);
+    vx.push_back(pvx);
+    vy.push_back(pvy);
+    timeAlive.push_back(0.0f);
+    lifetime.push_back(plifetime);
+}
+
+void ProjectilePool::integrate(float dt, float minX, float minY, float maxX, float maxY)
+{
+    const std::size_t count = size();
+    dead.resize(count);
+
+    advanceAndFlag(count, dt, minX, minY, maxX, maxY, x.data(), y.data(), prevX.data(), prevY.data(), vx.data(),
+                   vy.data(), timeAlive.data(), lifetime.data(), dead.data());
+
+    // Compact backwards: whatever swap-remove moves into slot i is already
+    // known to be alive
+    for (std::size_t i = count; i-- > 0;)
+    {
+        if (dead[i])
+            remove(i);
+    }
+}
+
+void ProjectilePool::remove(std::size_t index)
+{
+    x[index] = x.back();
+    y[index] = y.back();
+    prevX[index] = prevX.back();
+    prevY[index] = prevY.back();
+    vx[index] = vx.back();
+    vy[index] = vy.back();
+    timeAlive[index] = timeAlive.back();
+    lifetime[index] = lifetime.back();
+
+    x.pop_back();
+    y.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    vx.pop_back();
+    vy.pop_back();
+    timeAlive.pop_back();
+    lifetime.pop_back();
+}
+
+void ProjectilePool::clear()
+{
+    x.clear();
+    y.clear();
+    prevX.clear();
+    prevY.clear();
+    vx.clear();
+    vy.clear();
+    timeAlive.clear();
+    lifetime.clear();
+}
+
+void ProjectilePool::reserve(std::size_t capacity)
+{
+    x.reserve(capacity);
+    y.reserve(capacity);
+    prevX.reserve(capacity);
+    prevY.reserve(capacity);
+    vx.reserve(capacity);
+    vy.reserve(capacity);
+    timeAlive.reserve(capacity);
+    lifetime.reserve(capacity);
+    dead.reserve(capacity);
+}
+
+void ProjectilePool::reserveFor(std::size_t additional)
+{
+    std::size_t needed = x.size() + additional;
+    if (needed <= x.capacity())
+        return;
+    reserve(std::max(needed, x.capacity() * 2));
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Struct-of-arrays storage for ProjectileMode::RayCast bullets. A
+ * projectile has no entity and no physics body; it is just index i in every
+ * array.
+ *
+ * ShootingSystem spawns and integrates them, PhysicsSystem casts each one's
+ * movement this tick (prev -> current) against the Box2D world and removes
+ * the ones that hit, and the renderer draws them. Removal swaps the last
+ * projectile into the freed slot, so order is not preserved.
+ */
+class ProjectilePool
+{
+public:
+    explicit ProjectilePool(std::size_t capacity = 1024) { reserve(capacity); }
+
+    void spawn(float x, float y, float vx, float vy, float lifetime);
+
+    // Advance every projectile by dt, dropping the expired and the ones outside the bounds
+    void integrate(float dt, float minX, float minY, float maxX, float maxY);
+
+    void remove(std::size_t index);
+    void clear();
+    void reserve(std::size_t capacity);
+    // Room for `additional` more, growing geometrically so per-volley calls stay amortized
+    void reserveFor(std::size_t additional);
+
+    std::size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    // Per-projectile arrays, each size() long. prev* is the position at the
+    // start of the tick: the start of the swept ray and of render interpolation.
+    const float *getX() const { return x.data(); }
+    const float *getY() const { return y.data(); }
+    const float *getPrevX() const { return prevX.data(); }
+    const float *getPrevY() const { return prevY.data(); }
+    const float *getVelocityX() const { return vx.data(); } // Pixels per second
+    const float *getVelocityY() const { return vy.data(); }
+    const float *getTimeAlive() const { return timeAlive.data(); }
+    const float *getLifetime() const { return lifetime.data(); }
+
+private:
+    std::vector<float> x, y;
+    std::vector<float> prevX, prevY;
+    std::vector<float> vx, vy;
+    std::vector<float> timeAlive;
+    std::vector<float> lifetime;
+    std::vector<std::uint8_t> dead; // integrate() scratch: 1 = remove this tick
+};
@@ -1,204 +1,272 @@
 #include "ShootingSystem.hpp"
+#include "../core/CommandBuffer.hpp"
 #include "../core/Manager.hpp"
 #include "../core/Components.hpp"
+#include "../core/Log.hpp"
+#include "../core/Random.hpp"
 #include <SDL3/SDL.h>
-#include <iostream>
-#include <cmath>
 #include <algorithm>
+#include <cmath>
 
 ShootingSystem::ShootingSystem(Manager *mgr) : manager(mgr)
 {
-    std::cout << "[ShootingSystem] Initialized" << std::endl;
+    LOG_INFO(Shooting, "Initialized");
 }
 
 void ShootingSystem::update(float dt)
 {
-    // Check for shoot requests from blackboard
-    if (blackboard && blackboard->has("shoot_request") && blackboard->getValue<bool>("shoot_request"))
-    {
-        Entity shooterEntity = blackboard->getValue<Entity>("shoot_entity");
-        float shootTime = blackboard->getValue<float>("shoot_time");
-
-        handleShoot(shooterEntity, shootTime);
+    gameTime += dt;
 
-        // Clear the shoot request after handling
-        blackboard->setValue("shoot_request", false);
-    }
-
-    // Check for collision events to clean up bullet from our entity list
-    if (blackboard && blackboard->has("collision_event") && blackboard->getValue<bool>("collision_event"))
+    // Handle every shoot request posted this frame
+    if (events)
     {
-        Entity bullet = blackboard->getValue<Entity>("collision_bullet");
+        for (const ShootEvent &request : events->shoot)
+        {
+            handleShoot(request.shooter, request.time);
+        }
+    }
 
-        // Remove bullet from our entity list (it's already removed from manager by PhysicsSystem)
-        entities.erase(std::remove(entities.begin(), entities.end(), bullet), entities.end());
+    updateShooters();
+    updateBullets(dt);
 
-        std::cout << "[ShootingSystem] Cleaned up bullet " << bullet << " from entity list after collision" << std::endl;
+    // Ray-cast bullets; PhysicsSystem sweeps their movement for hits afterwards
+    if (projectiles)
+    {
+        projectiles->integrate(dt, -BULLET_MARGIN, -BULLET_MARGIN, 800 + BULLET_MARGIN, 600 + BULLET_MARGIN);
     }
+}
 
-    updateBullets(dt);
-    removeBulletsOutOfBounds();
-    removeExpiredBullets();
+void ShootingSystem::declareAccess(SystemAccess &access) const
+{
+    // Bullets are created immediately, so this writes the Manager and every
+    // component pool a bullet is added to
+    access.read<ShootEvent, Direction>()
+        .write<Shooter, Bullet, Position, PreviousPosition, Velocity, Renderable>()
+        .write<Manager, CommandBuffer, SpawnedEntityEvent, ProjectilePool, Random>();
 }
 
 void ShootingSystem::handleShoot(Entity shooterEntity, float currentTime)
 {
-    std::cout << "[ShootingSystem] Handling shoot for entity " << shooterEntity << std::endl;
+    LOG_TRACE(Shooting, "Handling shoot for entity %u", shooterEntity);
 
-    Position *pos = getComponent<Position>(shooterEntity);
-    Direction *dir = getComponent<Direction>(shooterEntity);
     Shooter *shooter = getComponent<Shooter>(shooterEntity);
-
-    if (!pos || !dir || !shooter || !shooter->canShoot)
+    if (!shooter || !shooter->canShoot || !getComponent<Position>(shooterEntity))
     {
-        std::cout << "[ShootingSystem] Cannot shoot - missing components or can't shoot" << std::endl;
+        LOG_TRACE(Shooting, "Cannot shoot - missing components or can't shoot");
         return;
     }
 
-    // Check fire rate
-    if (currentTime - shooter->lastShotTime < (1.0f / shooter->fireRate))
+    // Check fire rate; a burst finishes before the trigger can start another
+    if (currentTime - shooter->lastShotTime < (1.0f / shooter->fireRate) || shooter->burstShotsLeft > 0)
     {
-        std::cout << "[ShootingSystem] Fire rate limit not met" << std::endl;
+        LOG_TRACE(Shooting, "Fire rate limit not met");
         return;
     }
 
-    // Create bullet
-    Entity bullet = createBullet(*pos, *dir);
-    std::cout << "[ShootingSystem] Created bullet entity " << bullet << std::endl;
-
+    fireVolley(shooterEntity, *shooter, currentTime);
     shooter->lastShotTime = currentTime;
 }
 
-void ShootingSystem::updateBullets(float dt)
+void ShootingSystem::updateShooters()
 {
-    // Update all bullets
-    for (Entity entity : entities)
+    // Collect first: firing adds Position components, which must not happen
+    // while a view over Shooter is being walked
+    firingShooters.clear();
+    view<Shooter>().each(
+        [&](Entity entity, Shooter &shooter)
+        {
+            bool burstDue = shooter.burstShotsLeft > 0 && gameTime >= shooter.nextBurstTime;
+            if (burstDue || shooter.autoFire)
+            {
+                firingShooters.push_back({entity, burstDue});
+            }
+        });
+
+    for (const FiringShooter &firing : firingShooters)
     {
-        Bullet *bullet = getComponent<Bullet>(entity);
-        if (!bullet)
+        const Entity entity = firing.entity;
+        Shooter *shooter = getComponent<Shooter>(entity);
+        if (shooter->burstShotsLeft == 0)
+        {
+            handleShoot(entity, gameTime);
             continue;
+        }
 
-        Position *pos = getComponent<Position>(entity);
-        Velocity *vel = getComponent<Velocity>(entity);
-
-        if (!pos || !vel)
+        // An auto-fire turret mid-burst waits for burstInterval like everyone else
+        if (!firing.burstDue)
             continue;
 
-        // Move bullet
-        pos->x += vel->x * dt;
-        pos->y += vel->y * dt;
+        // Remaining burst shots follow the shooter's current aim
+        float x, y;
+        muzzlePosition(entity, x, y);
+        const Direction *dir = getComponent<Direction>(entity);
+        float angle = jittered(dir ? dir->angle : 0.0f, shooter->weapon);
+        spawnProjectiles(x, y, &angle, 1, shooter->weapon.speed, shooter->weapon.lifetime, shooter->projectileMode);
 
-        // Update lifetime
-        bullet->timeAlive += dt;
-
-        std::cout << "[ShootingSystem] Bullet " << entity << " at (" << pos->x << ", " << pos->y << ")" << std::endl;
+        --shooter->burstShotsLeft;
+        shooter->nextBurstTime += shooter->weapon.burstInterval;
     }
 }
 
-void ShootingSystem::removeBulletsOutOfBounds()
+void ShootingSystem::fireVolley(Entity shooterEntity, Shooter &shooter, float currentTime)
 {
-    bulletsToRemove.clear();
+    const Weapon &weapon = shooter.weapon;
+    const int count = std::max(1, weapon.count);
+    const Direction *dir = getComponent<Direction>(shooterEntity);
+    const float aim = dir ? dir->angle : 0.0f;
 
-    for (Entity entity : entities)
+    volleyAngles.clear();
+    switch (weapon.pattern)
     {
-        Bullet *bullet = getComponent<Bullet>(entity);
-        if (!bullet)
-            continue;
-
-        Position *pos = getComponent<Position>(entity);
-        if (!pos)
-            continue;
-
-        // Check bounds (800x600 window)
-        if (pos->x < -10 || pos->x > 810 || pos->y < -10 || pos->y > 610)
+    case WeaponPattern::Single:
+        volleyAngles.push_back(aim);
+        break;
+    case WeaponPattern::Burst:
+        volleyAngles.push_back(aim);
+        shooter.burstShotsLeft = count - 1;
+        shooter.nextBurstTime = currentTime + weapon.burstInterval;
+        break;
+    case WeaponPattern::Spread:
+        for (int i = 0; i < count; ++i)
+        {
+            float t = count > 1 ? static_cast<float>(i) / (count - 1) - 0.5f : 0.0f;
+            volleyAngles.push_back(aim + t * weapon.spreadAngle);
+        }
+        break;
+    case WeaponPattern::Ring:
+    case WeaponPattern::Spiral:
+        for (int i = 0; i < count; ++i)
+        {
+            volleyAngles.push_back(aim + shooter.spinAngle + 360.0f * i / count);
+        }
+        if (weapon.pattern == WeaponPattern::Spiral)
         {
-            bulletsToRemove.push_back(entity);
-            std::cout << "[ShootingSystem] Marking bullet " << entity << " for removal (out of bounds)" << std::endl;
+            shooter.spinAngle = std::fmod(shooter.spinAngle + weapon.spinRate, 360.0f);
         }
+        break;
     }
 
-    // Remove bullets
-    for (Entity entity : bulletsToRemove)
+    for (float &angle : volleyAngles)
     {
-        manager->removeEntity(entity);
-        // Remove from this system's entity list
-        entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
-        std::cout << "[ShootingSystem] Removed bullet " << entity << std::endl;
+        angle = jittered(angle, weapon);
     }
+
+    float x, y;
+    muzzlePosition(shooterEntity, x, y);
+    spawnProjectiles(x, y, volleyAngles.data(), volleyAngles.size(), weapon.speed, weapon.lifetime,
+                     shooter.projectileMode);
+    LOG_TRACE(Shooting, "Entity %u fired %zu projectiles", shooterEntity, volleyAngles.size());
+}
+
+float ShootingSystem::jittered(float angleDegrees, const Weapon &weapon)
+{
+    // No draw at all for exact weapons, so they don't shift the shared sequence
+    if (weapon.jitter <= 0.0f || !random)
+        return angleDegrees;
+    return angleDegrees + random->range(-weapon.jitter, weapon.jitter);
 }
 
-void ShootingSystem::removeExpiredBullets()
+void ShootingSystem::muzzlePosition(Entity shooterEntity, float &x, float &y) const
 {
-    bulletsToRemove.clear();
+    // Fire from the shooter's center
+    const Position *pos = getComponent<Position>(shooterEntity);
+    const Renderable *renderable = getComponent<Renderable>(shooterEntity);
+    x = pos->x + (renderable ? renderable->width * 0.5f : 0.0f);
+    y = pos->y + (renderable ? renderable->height * 0.5f : 0.0f);
+}
+
+void ShootingSystem::spawnProjectile(float x, float y, float angleDegrees, ProjectileMode mode)
+{
+    spawnProjectiles(x, y, &angleDegrees, 1, BULLET_SPEED, BULLET_LIFETIME, mode);
+}
 
-    for (Entity entity : entities)
+void ShootingSystem::spawnProjectiles(float x, float y, const float *anglesDegrees, std::size_t count, float speed,
+                                      float lifetime, ProjectileMode mode)
+{
+    volleyVelocityX.resize(count);
+    volleyVelocityY.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
     {
-        Bullet *bullet = getComponent<Bullet>(entity);
-        if (!bullet)
-            continue;
+        float radians = anglesDegrees[i] * static_cast<float>(M_PI) / 180.0f;
+        volleyVelocityX[i] = std::cos(radians) * speed;
+        volleyVelocityY[i] = std::sin(radians) * speed;
+    }
 
-        if (bullet->timeAlive >= bullet->lifetime)
+    if (mode == ProjectileMode::RayCast && projectiles)
+    {
+        projectiles->reserveFor(count);
+        for (std::size_t i = 0; i < count; ++i)
         {
-            bulletsToRemove.push_back(entity);
-            std::cout << "[ShootingSystem] Marking bullet " << entity << " for removal (expired)" << std::endl;
+            projectiles->spawn(x, y, volleyVelocityX[i], volleyVelocityY[i], lifetime);
         }
+        LOG_TRACE(Shooting, "Spawned %zu ray-cast projectiles at (%.1f, %.1f)", count, x, y);
+        return;
     }
 
-    // Remove bullets
-    for (Entity entity : bulletsToRemove)
-    {
-        manager->removeEntity(entity);
-        // Remove from this system's entity list
-        entities.erase(std::remove(entities.begin(), entities.end(), entity), entities.end());
-        std::cout << "[ShootingSystem] Removed bullet " << entity << std::endl;
-    }
+    createBullets(x, y, count, lifetime);
 }
 
-Entity ShootingSystem::createBullet(const Position &startPos, const Direction &dir)
+void ShootingSystem::updateBullets(float dt)
 {
-    Entity bullet = manager->createEntity();
-
-    // Position at shooter's center
-    Position bulletPos = {startPos.x + 16, startPos.y + 16}; // Center of 32x32 player
-    addComponent<Position>(bullet, bulletPos);
-
-    // Calculate velocity based on direction
-    float radians = dir.angle * M_PI / 180.0f;
-    Velocity vel = {
-        cos(radians) * 400.0f, // 400 pixels/second
-        sin(radians) * 400.0f};
-    addComponent<Velocity>(bullet, vel);
-
-    // Bullet component
-    Bullet bulletComp = {400.0f, 3.0f, 0.0f}; // speed, lifetime, timeAlive
-    addComponent<Bullet>(bullet, bulletComp);
-
-    // Make it renderable
-    Renderable renderable = {"yellow", 4, 4, false}; // Small yellow square
-    addComponent<Renderable>(bullet, renderable);
-
-    // Add bullet to this system's entity list so it gets updated
-    entities.push_back(bullet);
+    // Box2D moves entity bullets (their bodies carry the velocity and the
+    // positions come back through body move events), so this pass only ages
+    // and retires them and leaves their bodies untouched
+    view<Bullet, Position>().each(
+        [&](Entity entity, Bullet &bullet, const Position &pos)
+        {
+            bullet.timeAlive += dt;
+
+            // Left the 800x600 window or lived out its lifetime
+            bool outOfBounds = pos.x < -BULLET_MARGIN || pos.x > 800 + BULLET_MARGIN || pos.y < -BULLET_MARGIN ||
+                               pos.y > 600 + BULLET_MARGIN;
+            if (outOfBounds || bullet.timeAlive >= bullet.lifetime)
+            {
+                commands->destroyEntity(entity);
+                LOG_DEBUG(Shooting, "Marking bullet %u for removal (%s)", entity, outOfBounds ? "out of bounds" : "expired");
+                return;
+            }
+            LOG_TRACE(Shooting, "Bullet %u at (%.1f, %.1f)", entity, pos.x, pos.y);
+        });
+}
 
-    // Notify physics system about new bullet entity via blackboard
-    if (blackboard)
+void ShootingSystem::createBullets(float x, float y, std::size_t count, float lifetime)
+{
+    // Handles and component slots for the whole batch are reserved once,
+    // instead of growing every pool bullet by bullet
+    spawnedBullets.clear();
+    manager->createEntities(count, spawnedBullets);
+    reserveComponents<Position>(spawnedBullets.size());
+    reserveComponents<PreviousPosition>(spawnedBullets.size());
+    reserveComponents<Velocity>(spawnedBullets.size());
+    reserveComponents<Bullet>(spawnedBullets.size());
+    reserveComponents<Renderable>(spawnedBullets.size());
+
+    for (std::size_t i = 0; i < spawnedBullets.size(); ++i)
     {
-        blackboard->setValue("physics_new_entity", bullet);
-        blackboard->setValue("physics_new_entity_request", true);
-    }
-
-    std::cout << "[ShootingSystem] Created bullet with velocity (" << vel.x << ", " << vel.y << ")" << std::endl;
+        Entity bullet = spawnedBullets[i];
+        float vx = volleyVelocityX[i];
+        float vy = volleyVelocityY[i];
+
+        addComponent<Position>(bullet, {x, y});
+        addComponent<PreviousPosition>(bullet, {x, y});
+        addComponent<Velocity>(bullet, {vx, vy});
+        addComponent<Bullet>(bullet, {std::hypot(vx, vy), lifetime, 0.0f}); // speed, lifetime, timeAlive
+        addComponent<Renderable>(bullet, {"yellow", 4, 4, false});        // Small yellow square
+
+        // Notify physics system about new bullet entity
+        if (events)
+        {
+            events->spawned.push({bullet});
+        }
 
-    return bullet;
+        LOG_TRACE(Shooting, "Created bullet %u with velocity (%.1f, %.1f)", bullet, vx, vy);
+    }
 }
 
 void ShootingSystem::removeBulletOnCollision(Entity bullet)
 {
-    // Remove bullet from manager
-    manager->removeEntity(bullet);
-
-    // Remove from this system's entity list
-    entities.erase(std::remove(entities.begin(), entities.end(), bullet), entities.end());
+    // Destroyed at the end-of-tick flush
+    commands->destroyEntity(bullet);
 
-    std::cout << "[ShootingSystem] Removed bullet " << bullet << " on collision" << std::endl;
+    LOG_DEBUG(Shooting, "Queued bullet %u for removal on collision", bullet);
 }
@@ -1,25 +1,63 @@
 #pragma once
 #include "../core/System.hpp"
 #include "../core/Components.hpp"
+#include "ProjectilePool.hpp"
+#include <cstddef>
 #include <unordered_map>
 #include <vector>
 
 class Manager; // Forward declaration
+class Random;
 
 class ShootingSystem : public System
 {
 public:
     ShootingSystem(Manager *manager);
     void update(float dt) override;
+    void declareAccess(SystemAccess &access) const override;
     void handleShoot(Entity shooterEntity, float currentTime);
 
+    // Fire one projectile from (x, y) towards angleDegrees, simulated as the given mode
+    void spawnProjectile(float x, float y, float angleDegrees, ProjectileMode mode);
+
+    // Bulk spawn: one projectile from (x, y) per angle, with storage for the whole batch reserved up front
+    void spawnProjectiles(float x, float y, const float *anglesDegrees, std::size_t count, float speed,
+                          float lifetime, ProjectileMode mode);
+
+    // Storage for ProjectileMode::RayCast bullets (owned by the engine)
+    void setProjectilePool(ProjectilePool *pool) { projectiles = pool; }
+
+    // Gameplay RNG for weapon jitter (owned by the engine); without one, shots are exact
+    void setRandom(Random *rng) { random = rng; }
+
+    // Bullets leave play this far outside the 800x600 window
+    static constexpr float BULLET_MARGIN = 10.0f;
+    static constexpr float BULLET_SPEED = 400.0f;   // Pixels per second
+    static constexpr float BULLET_LIFETIME = 3.0f; // Seconds
+
 private:
     Manager *manager;
-    std::vector<Entity> bulletsToRemove;
+    ProjectilePool *projectiles = nullptr;
+    Random *random = nullptr;
+    float gameTime = 0.0f; // Simulated seconds, for auto-fire and bursts
+
+    // Scratch buffers reused by every volley
+    std::vector<float> volleyAngles;
+    std::vector<float> volleyVelocityX, volleyVelocityY;
+    std::vector<Entity> spawnedBullets;
+
+    struct FiringShooter
+    {
+        Entity entity;
+        bool burstDue; // The next shot of a running burst is due this tick
+    };
+    std::vector<FiringShooter> firingShooters;
 
-    void updateBullets(float dt);
-    void removeBulletsOutOfBounds();
-    void removeExpiredBullets();
+    void updateShooters();        // Auto-fire turrets and the remaining shots of bursts
+    void updateBullets(float dt); // Move, age and retire entity bullets
+    void fireVolley(Entity shooterEntity, Shooter &shooter, float currentTime);
+    void muzzlePosition(Entity shooterEntity, float &x, float &y) const;
+    float jittered(float angleDegrees, const Weapon &weapon);
     void removeBulletOnCollision(Entity bullet);
-    Entity createBullet(const Position &startPos, const Direction &dir);
+    void createBullets(float x, float y, std::size_t count, float lifetime);
 };
@@ -1,12 +1,13 @@
 #include "InputSystem.hpp"
+#include "../core/BlackboardKeys.hpp"
 #include "../core/Manager.hpp"
+#include "../core/Log.hpp"
 #include <SDL3/SDL.h>
-#include <iostream>
 #include <cmath>
+#include <utility>
 
 void InputSystem::update(float dt)
 {
-  static float gameTime = 0.0f;
   gameTime += dt;
 
   // For each entity with Input and Position
@@ -43,13 +44,10 @@ void InputSystem::update(float dt)
       moved = true;
     }
 
-    // Post movement request to blackboard
-    if (moved && blackboard)
+    // Post movement request
+    if (moved && events)
     {
-      blackboard->setValue("movement_request", true);
-      blackboard->setValue("movement_entity", entity);
-      blackboard->setValue("movement_x", moveX);
-      blackboard->setValue("movement_y", moveY);
+      events->movement.push({entity, moveX, moveY});
     }
 
     // Update player direction based on movement
@@ -64,10 +62,16 @@ void InputSystem::update(float dt)
       handleShooting(entity, gameTime);
     }
 
-    std::cout << "[InputSystem] Player at (" << pos->x << ", " << pos->y << ")" << std::endl;
+    LOG_TRACE(Input, "Player at (%.1f, %.1f)", pos->x, pos->y);
   }
 }
 
+void InputSystem::declareAccess(SystemAccess &access) const
+{
+  access.read<Input, Position>()
+      .write<Direction, MovementEvent, ShootEvent>();
+}
+
 void InputSystem::updatePlayerDirection(Entity entity)
 {
   Direction *dir = getComponent<Direction>(entity);
@@ -110,18 +114,55 @@ void InputSystem::updatePlayerDirection(Entity entity)
   }
 
   dir->angle = newAngle;
-  std::cout << "[InputSystem] Player direction updated to " << dir->angle << " degrees" << std::endl;
+  LOG_TRACE(Input, "Player direction updated to %.1f degrees", dir->angle);
 }
 
 void InputSystem::handleShooting(Entity entity, float currentTime)
 {
-  if (blackboard)
+  if (events)
+  {
+    // Post shooting request
+    events->shoot.push({entity, currentTime});
+    LOG_TRACE(Input, "Posted shoot request");
+  }
+}
+
+namespace
+{
+  const std::pair<SDL_Scancode, std::uint32_t> KEY_BITS[] = {{SDL_SCANCODE_W, InputSystem::KEY_W},
+                                                            {SDL_SCANCODE_A, InputSystem::KEY_A},
+                                                            {SDL_SCANCODE_S, InputSystem::KEY_S},
+                                                            {SDL_SCANCODE_D, InputSystem::KEY_D},
+                                                            {SDL_SCANCODE_SPACE, InputSystem::KEY_SPACE}};
+}
+
+std::uint32_t InputSystem::getKeyMask() const
+{
+  // Every controllable entity sees the same keys, so the first one speaks for all
+  if (entities.empty())
+    return 0;
+  auto it = keyStates.find(entities.front());
+  if (it == keyStates.end())
+    return 0;
+
+  std::uint32_t mask = 0;
+  for (const auto &[scancode, bit] : KEY_BITS)
   {
-    // Post shooting request to blackboard
-    blackboard->setValue("shoot_request", true);
-    blackboard->setValue("shoot_entity", entity);
-    blackboard->setValue("shoot_time", currentTime);
-    std::cout << "[InputSystem] Posted shoot request to blackboard" << std::endl;
+    auto key = it->second.find(scancode);
+    if (key != it->second.end() && key->second)
+      mask |= bit;
+  }
+  return mask;
+}
+
+void InputSystem::setKeyMask(std::uint32_t mask)
+{
+  for (Entity entity : entities)
+  {
+    for (const auto &[scancode, bit] : KEY_BITS)
+    {
+      keyStates[entity][scancode] = (mask & bit) != 0;
+    }
   }
 }
 
@@ -138,14 +179,26 @@ void InputSystem::handleEvent(const SDL_Event &event)
       if (sc == SDL_SCANCODE_H)
       {
         // Toggle HUD
-        blackboard->setValue("hud_toggle_request", true);
-        std::cout << "[InputSystem] HUD toggle requested" << std::endl;
+        blackboard->set(BlackboardKeys::HUD_TOGGLE_REQUEST, true);
+        LOG_DEBUG(Input, "HUD toggle requested");
+      }
+      else if (sc == SDL_SCANCODE_P)
+      {
+        // Toggle the profiler breakdown
+        blackboard->set(BlackboardKeys::PROFILER_OVERLAY_REQUEST, true);
+        LOG_DEBUG(Input, "Profiler overlay toggle requested");
+      }
+      else if (sc == SDL_SCANCODE_F9)
+      {
+        // Write a trace of the last few seconds
+        blackboard->set(BlackboardKeys::PROFILER_DUMP_REQUEST, true);
+        LOG_DEBUG(Input, "Profiler trace requested");
       }
       else if (sc == SDL_SCANCODE_ESCAPE)
       {
         // Exit game
-        blackboard->setValue("exit_game_request", true);
-        std::cout << "[InputSystem] Exit game requested" << std::endl;
+        blackboard->set(BlackboardKeys::EXIT_GAME_REQUEST, true);
+        LOG_INFO(Input, "Exit game requested");
       }
     }
 
@@ -154,6 +207,6 @@ void InputSystem::handleEvent(const SDL_Event &event)
       keyStates[entity][sc] = pressed;
     }
 
-    std::cout << "[InputSystem] Key " << sc << " " << (pressed ? "pressed" : "released") << std::endl;
+    LOG_TRACE(Input, "Key %d %s", static_cast<int>(sc), pressed ? "pressed" : "released");
   }
 }
\ No newline at end of file
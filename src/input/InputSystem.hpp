@@ -2,6 +2,7 @@
 #include "../core/Components.hpp"
 #include "../core/System.hpp"
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include <unordered_map>
 
 /**
@@ -12,12 +13,24 @@ class InputSystem : public System
 public:
   InputSystem() = default;
   void update(float dt) override;
+  void declareAccess(SystemAccess &access) const override;
   void handleEvent(const SDL_Event &event);
 
+  // Held gameplay keys as a bitmask of KEY_* flags, for replay logs
+  static constexpr std::uint32_t KEY_W = 1u << 0;
+  static constexpr std::uint32_t KEY_A = 1u << 1;
+  static constexpr std::uint32_t KEY_S = 1u << 2;
+  static constexpr std::uint32_t KEY_D = 1u << 3;
+  static constexpr std::uint32_t KEY_SPACE = 1u << 4;
+  std::uint32_t getKeyMask() const;
+  void setKeyMask(std::uint32_t mask);
+
   // Map of entity to pressed keys
   std::unordered_map<Entity, std::unordered_map<SDL_Scancode, bool>> keyStates;
 
 private:
   void updatePlayerDirection(Entity entity);
   void handleShooting(Entity entity, float currentTime);
+
+  float gameTime = 0.0f; // Simulated time, advanced only by ticks
 };
\ No newline at end of file
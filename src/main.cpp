@@ -1,17 +1,85 @@
 #include "core/GameEngine.hpp"
-#include <iostream>
+#include "core/Log.hpp"
 
-int main()
+#include <cstdlib>
+#include <cstring>
+
+namespace
 {
+  bool parseArgs(int argc, char *argv[], LaunchOptions &options)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      bool hasValue = i + 1 < argc;
+      if (std::strcmp(argv[i], "--deterministic") == 0)
+      {
+        options.deterministic = true;
+      }
+      else if (std::strcmp(argv[i], "--seed") == 0 && hasValue)
+      {
+        options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+      }
+      else if (std::strcmp(argv[i], "--record") == 0 && hasValue)
+      {
+        options.recordPath = argv[++i];
+      }
+      else if (std::strcmp(argv[i], "--verify") == 0 && hasValue)
+      {
+        options.verifyPath = argv[++i];
+      }
+      else if (std::strcmp(argv[i], "--headless") == 0)
+      {
+        options.headless = true;
+      }
+      else if (std::strcmp(argv[i], "--fixed-rate") == 0)
+      {
+        options.fixedRate = true;
+      }
+      else if (std::strcmp(argv[i], "--ticks") == 0 && hasValue)
+      {
+        options.maxTicks = std::strtoull(argv[++i], nullptr, 10);
+      }
+      else if (std::strcmp(argv[i], "--trace") == 0 && hasValue)
+      {
+        options.tracePath = argv[++i];
+      }
+      else
+      {
+        LOG_ERROR(Engine, "Unknown or incomplete option '%s'", argv[i]);
+        LOG_INFO(Engine,
+                 "Usage: %s [--headless [--fixed-rate]] [--ticks N] [--deterministic] [--seed N] "
+                 "[--record FILE | --verify FILE] [--trace FILE]",
+                 argv[0]);
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  LaunchOptions options;
+  if (!parseArgs(argc, argv, options))
+  {
+    Logger::instance().shutdown();
+    return 2;
+  }
+
   GameEngine game;
+  game.setLaunchOptions(options);
 
   if (!game.initialize())
   {
-    std::cerr << "Failed to initialize game engine" << std::endl;
+    LOG_ERROR(Engine, "Failed to initialize game engine");
+    Logger::instance().shutdown();
     return 1;
   }
 
   game.run();
+  int exitCode = game.getExitCode();
 
-  return 0;
+  // Drain anything still queued before the process exits
+  Logger::instance().shutdown();
+  return exitCode;
 }
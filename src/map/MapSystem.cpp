@@ -1,14 +1,14 @@
 #include "MapSystem.hpp"
 #include "../core/Manager.hpp"
+#include "../core/Log.hpp"
 #include <nlohmann/json.hpp>
 #include <fstream>
-#include <iostream>
 
 using json = nlohmann::json;
 
 MapSystem::MapSystem(Manager *mgr) : manager(mgr)
 {
-    std::cout << "[MapSystem] Initialized" << std::endl;
+    LOG_INFO(Map, "Initialized");
 }
 
 void MapSystem::update(float dt)
@@ -20,12 +20,17 @@ void MapSystem::update(float dt)
     // This method is now essentially empty but kept for potential future map-specific logic
 }
 
+void MapSystem::declareAccess(SystemAccess & /*access*/) const
+{
+    // update() only touches the system's own map state
+}
+
 bool MapSystem::loadMap(const std::string &mapFile)
 {
     std::ifstream file(mapFile);
     if (!file.is_open())
     {
-        std::cerr << "[MapSystem] Failed to open map file: " << mapFile << std::endl;
+        LOG_ERROR(Map, "Failed to open map file: %s", mapFile.c_str());
         return false;
     }
 
@@ -38,6 +43,9 @@ bool MapSystem::loadMap(const std::string &mapFile)
         mapData.width = j["width"].get<int>();
         mapData.height = j["height"].get<int>();
 
+        // Spatial hash cell size: roughly the typical obstacle size works best
+        mapData.cellSize = j.value("cellSize", 64.0f);
+
         // Parse obstacles
         mapData.obstacles.clear();
         for (const auto &obs : j["obstacles"])
@@ -51,16 +59,24 @@ bool MapSystem::loadMap(const std::string &mapFile)
             obstacle.g = obs["color"]["g"].get<int>();
             obstacle.b = obs["color"]["b"].get<int>();
 
+            std::string body = obs.value("body", "dynamic");
+            if (body == "static")
+                obstacle.bodyType = BodyType::Static;
+            else if (body == "kinematic")
+                obstacle.bodyType = BodyType::Kinematic;
+            else if (body != "dynamic")
+                LOG_WARN(Map, "Unknown obstacle body type '%s', using dynamic", body.c_str());
+
             mapData.obstacles.push_back(obstacle);
         }
 
         mapLoaded = true;
-        std::cout << "[MapSystem] Loaded map with " << mapData.obstacles.size() << " obstacles" << std::endl;
+        LOG_INFO(Map, "Loaded map with %zu obstacles", mapData.obstacles.size());
         return true;
     }
     catch (const std::exception &e)
     {
-        std::cerr << "[MapSystem] Error parsing map file: " << e.what() << std::endl;
+        LOG_ERROR(Map, "Error parsing map file: %s", e.what());
         return false;
     }
 }
@@ -72,24 +88,27 @@ void MapSystem::createMapEntities()
 
     for (const auto &obs : mapData.obstacles)
     {
-        createObstacle(obs.x, obs.y, obs.width, obs.height, obs.r, obs.g, obs.b);
+        createObstacle(obs);
     }
 }
 
-void MapSystem::createObstacle(float x, float y, float width, float height, int r, int g, int b)
+void MapSystem::createObstacle(const MapObstacle &obs)
 {
     Entity obstacle = manager->createEntity();
+    float x = obs.x;
+    float y = obs.y;
 
     // Add Position component
     Position pos;
     pos.x = x;
     pos.y = y;
     addComponent(obstacle, pos);
+    addComponent(obstacle, PreviousPosition{x, y});
 
     // Add Renderable component
     Renderable renderable;
-    renderable.width = width;
-    renderable.height = height;
+    renderable.width = obs.width;
+    renderable.height = obs.height;
     // Use the actual color from map data instead of hardcoded "brown"
     renderable.color = "obstacle"; // Could be enhanced to use RGB values
     addComponent(obstacle, renderable);
@@ -99,9 +118,10 @@ void MapSystem::createObstacle(float x, float y, float width, float height, int
     vel.x = 0.0f;
     vel.y = 0.0f;
     addComponent(obstacle, vel);
+    addComponent(obstacle, PhysicsBody{obs.bodyType});
 
     obstacleEntities.push_back(obstacle);
     entities.push_back(obstacle);
 
-    std::cout << "[MapSystem] Created obstacle entity " << obstacle << " at (" << x << ", " << y << ")" << std::endl;
+    LOG_DEBUG(Map, "Created obstacle entity %u at (%.1f, %.1f)", obstacle, x, y);
 }
@@ -10,11 +10,13 @@ struct MapObstacle
     float x, y;
     float width, height;
     int r, g, b; // Color
+    BodyType bodyType = BodyType::Dynamic; // "body": "static" | "kinematic" | "dynamic"
 };
 
 struct MapData
 {
-    int width, height;
+    int width, height; // World bounds; PhysicsSystem walls them in
+    float cellSize = 64.0f; // Spatial hash cell size in pixels ("cellSize", optional)
     std::vector<MapObstacle> obstacles;
 };
 
@@ -26,6 +28,7 @@ class MapSystem : public System
 public:
     MapSystem(Manager *mgr);
     void update(float dt) override;
+    void declareAccess(SystemAccess &access) const override;
 
     bool loadMap(const std::string &mapFile);
     void createMapEntities();
@@ -37,5 +40,5 @@ private:
     std::vector<Entity> obstacleEntities;
     bool mapLoaded = false;
 
-    void createObstacle(float x, float y, float width, float height, int r, int g, int b);
+    void createObstacle(const MapObstacle &obstacle);
 };
@@ -10,8 +10,9 @@ class MovementSystem : public System
 public:
     MovementSystem() = default;
     void update(float dt) override;
+    void declareAccess(SystemAccess &access) const override;
 
 private:
-    void applyVelocityEffects(Entity entity, float dt);
-    void applyBoundaryConstraints(Entity entity);
+    void applyVelocityEffects(Velocity &vel, float dt);
+    void applyBoundaryConstraints(const Input &input, const Position &pos, Velocity &vel);
 };
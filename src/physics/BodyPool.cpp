@@ -0,0 +1,116 @@
+#include "BodyPool.hpp"
+
+BodyPool::TemplateId BodyPool::addTemplate(const BodyTemplate &bodyTemplate)
+{
+    templates.push_back({bodyTemplate, {}, {}});
+    return templates.size() - 1;
+}
+
+void BodyPool::warmUp(b2WorldId worldId, TemplateId id, std::size_t count)
+{
+    TemplatePool &pool = templates[id];
+    pool.free.reserve(pool.free.size() + count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        pool.free.push_back(create(worldId, pool.bodyTemplate));
+        ++pool.stats.created;
+    }
+    pool.stats.free = pool.free.size();
+}
+
+b2BodyId BodyPool::acquire(b2WorldId worldId, TemplateId id, b2Vec2 position, b2Vec2 velocity, void *userData)
+{
+    TemplatePool &pool = templates[id];
+
+    if (pool.free.empty())
+    {
+        pool.free.push_back(create(worldId, pool.bodyTemplate));
+        ++pool.stats.misses;
+        ++pool.stats.created;
+    }
+    else
+    {
+        ++pool.stats.hits;
+    }
+
+    PooledBody pooled = pool.free.back();
+    pool.free.pop_back();
+
+    // Place it while still disabled so the broad-phase only sees the new
+    // position; velocity has no solver state to land in until it is enabled
+    b2Body_SetTransform(pooled.body, position, b2Rot_identity);
+    b2Body_Enable(pooled.body);
+    b2Body_SetLinearVelocity(pooled.body, velocity);
+    b2Body_SetAngularVelocity(pooled.body, 0.0f);
+
+    b2Body_SetUserData(pooled.body, userData);
+    b2Shape_SetUserData(pooled.shape, userData);
+
+    ++pool.stats.live;
+    pool.stats.free = pool.free.size();
+    return pooled.body;
+}
+
+void BodyPool::release(TemplateId id, b2BodyId bodyId)
+{
+    TemplatePool &pool = templates[id];
+
+    // Clear the user data so late events for this body resolve to no entity
+    b2ShapeId shapeId = shapeOf(bodyId);
+    b2Body_Disable(bodyId);
+    b2Body_SetUserData(bodyId, nullptr);
+    b2Shape_SetUserData(shapeId, nullptr);
+
+    pool.free.push_back({bodyId, shapeId});
+    if (pool.stats.live > 0)
+        --pool.stats.live;
+    pool.stats.free = pool.free.size();
+}
+
+void BodyPool::clear()
+{
+    for (TemplatePool &pool : templates)
+    {
+        pool.free.clear();
+        pool.stats.free = 0;
+        pool.stats.live = 0;
+    }
+}
+
+BodyPool::PooledBody BodyPool::create(b2WorldId worldId, const BodyTemplate &bodyTemplate)
+{
+    b2BodyDef bodyDef = b2DefaultBodyDef();
+    bodyDef.type = bodyTemplate.type;
+    bodyDef.isBullet = bodyTemplate.isBullet;
+    bodyDef.fixedRotation = bodyTemplate.fixedRotation;
+    bodyDef.isEnabled = false; // Only enters the broad-phase once acquired
+
+    b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
+
+    b2ShapeDef shapeDef = b2DefaultShapeDef();
+    shapeDef.density = bodyTemplate.density;
+    shapeDef.isSensor = bodyTemplate.isSensor;
+    shapeDef.enableContactEvents = bodyTemplate.enableContactEvents;
+    shapeDef.enableSensorEvents = bodyTemplate.enableSensorEvents;
+
+    b2ShapeId shapeId;
+    if (bodyTemplate.shape == BodyTemplate::Shape::Circle)
+    {
+        b2Circle circle = {{0.0f, 0.0f}, bodyTemplate.radius};
+        shapeId = b2CreateCircleShape(bodyId, &shapeDef, &circle);
+    }
+    else
+    {
+        b2Polygon box = b2MakeBox(bodyTemplate.halfWidth, bodyTemplate.halfHeight);
+        shapeId = b2CreatePolygonShape(bodyId, &shapeDef, &box);
+    }
+
+    return {bodyId, shapeId};
+}
+
+b2ShapeId BodyPool::shapeOf(b2BodyId bodyId)
+{
+    b2ShapeId shapeId = b2_nullShapeId;
+    b2Body_GetShapes(bodyId, &shapeId, 1);
+    return shapeId;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <box2d/box2d.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Everything needed to build one kind of pooled body: the body
+ * settings and its single shape (sizes in meters).
+ */
+struct BodyTemplate
+{
+    enum class Shape
+    {
+        Circle,
+        Box
+    };
+
+    std::string name;
+    b2BodyType type = b2_dynamicBody;
+    Shape shape = Shape::Circle;
+    float radius = 0.0f;                       // Circle
+    float halfWidth = 0.0f, halfHeight = 0.0f; // Box
+    float density = 1.0f;
+    bool isSensor = false;
+    bool isBullet = false;
+    bool fixedRotation = false;
+    bool enableContactEvents = true;
+    bool enableSensorEvents = true;
+};
+
+/**
+ * @brief Hit/miss counters for one template. A miss is an acquire that had to
+ * create a new body; at steady state every acquire should be a hit.
+ */
+struct BodyPoolStats
+{
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t created = 0; // Warm-up and misses
+    std::size_t free = 0;    // Disabled bodies waiting for reuse
+    std::size_t live = 0;    // Bodies handed out and not yet released
+};
+
+/**
+ * @brief Recycles short-lived Box2D bodies (bullets, effects) per template.
+ *
+ * Released bodies are disabled with b2Body_Disable, which takes them out of
+ * the broad-phase and the solver but keeps their memory. acquire() moves a
+ * free body into place, resets its velocity and user data and re-enables it,
+ * so spawning a body costs no b2CreateBody/b2Create*Shape once the pool has
+ * grown to the peak number of live bodies. Bodies belong to the world they
+ * were created in; clear() must be called if that world is destroyed first.
+ */
+class BodyPool
+{
+public:
+    using TemplateId = std::size_t;
+
+    TemplateId addTemplate(const BodyTemplate &bodyTemplate);
+    const BodyTemplate &getTemplate(TemplateId id) const { return templates[id].bodyTemplate; }
+    std::size_t getTemplateCount() const { return templates.size(); }
+
+    // Create disabled bodies up front so the first spawns are hits
+    void warmUp(b2WorldId worldId, TemplateId id, std::size_t count);
+
+    // An enabled body at position (meters) with the given velocity; userData goes on body and shape
+    b2BodyId acquire(b2WorldId worldId, TemplateId id, b2Vec2 position, b2Vec2 velocity, void *userData);
+
+    // Disable the body and keep it for the next acquire of the same template
+    void release(TemplateId id, b2BodyId bodyId);
+
+    const BodyPoolStats &getStats(TemplateId id) const { return templates[id].stats; }
+
+    // Forget every body without touching Box2D (the world that owned them is gone)
+    void clear();
+
+private:
+    struct PooledBody
+    {
+        b2BodyId body;
+        b2ShapeId shape;
+    };
+
+    struct TemplatePool
+    {
+        BodyTemplate bodyTemplate;
+        std::vector<PooledBody> free;
+        BodyPoolStats stats;
+    };
+
+    std::vector<TemplatePool> templates; // Indexed by TemplateId
+
+    PooledBody create(b2WorldId worldId, const BodyTemplate &bodyTemplate);
+    static b2ShapeId shapeOf(b2BodyId bodyId);
+};
@@ -1,57 +1,128 @@
 #include "PhysicsSystem.hpp"
+#include "../core/CommandBuffer.hpp"
 #include "../core/Manager.hpp"
-#include <iostream>
+#include "../core/Log.hpp"
+#include "../core/Profiler.hpp"
 #include <algorithm>
 #include <cmath>
-#include <cmath>
+#include <cstdint>
 #include <SDL3/SDL.h>
 
-PhysicsSystem::PhysicsSystem(Manager *mgr) : manager(mgr)
+namespace
+{
+    // Box2D's internal worker limit; larger pools would hand out slots it has no scratch memory for
+    constexpr std::size_t MAX_SOLVER_WORKERS = 64;
+
+    // Below this many ray-cast bullets the sweep is cheaper on one thread
+    constexpr int PROJECTILES_PER_CAST_TASK = 256;
+
+    bool isObstacle(Entity entity)
+    {
+        return entity != NULL_ENTITY && !getComponent<Bullet>(entity) && !getComponent<Input>(entity);
+    }
+}
+
+PhysicsSystem::PhysicsSystem(Manager *mgr, ThreadPool *pool) : manager(mgr), threadPool(pool)
 {
     // Create Box2D world with default settings
     b2WorldDef worldDef = b2DefaultWorldDef();
     worldDef.gravity = (b2Vec2){0.0f, 0.0f}; // No gravity for top-down shooter
+    worldDef.enableSleep = true;              // Resting obstacles drop out of the solver
+
+    // Box2D sizes its per-worker scratch memory by workerCount and indexes it
+    // with the slot each chunk runs on, so it must cover every pool slot
+    if (threadPool && threadPool->getConcurrency() > MAX_SOLVER_WORKERS)
+    {
+        LOG_WARN(Physics, "Thread pool has %zu threads, more than Box2D supports; stepping single-threaded",
+                 threadPool->getConcurrency());
+        threadPool = nullptr;
+    }
+    if (threadPool)
+    {
+        worldDef.workerCount = static_cast<int>(threadPool->getConcurrency());
+        worldDef.enqueueTask = &PhysicsSystem::enqueueTask;
+        worldDef.finishTask = &PhysicsSystem::finishTask;
+        worldDef.userTaskContext = this;
+    }
     worldId = b2CreateWorld(&worldDef);
 
-    std::cout << "[PhysicsSystem] Initialized with Box2D 3.x" << std::endl;
+    // Small sensor circle with continuous collision, recycled for every body bullet
+    BodyTemplate bullet;
+    bullet.name = "bullet";
+    bullet.shape = BodyTemplate::Shape::Circle;
+    bullet.radius = 2.0f * METERS_PER_PIXEL;
+    bullet.density = 0.1f;
+    bullet.isSensor = true; // Bullets are sensors for collision detection
+    bullet.isBullet = true;
+    bullet.enableSensorEvents = true;
+    bulletTemplate = bodyPool.addTemplate(bullet);
+
+    LOG_INFO(Physics, "Initialized with Box2D 3.x (%d solver threads)", worldDef.workerCount);
 }
 
 PhysicsSystem::~PhysicsSystem()
 {
+    logBodyPoolStats();
+    bodyPool.clear();
     if (b2World_IsValid(worldId))
     {
         b2DestroyWorld(worldId);
     }
 }
 
+void PhysicsSystem::logBodyPoolStats() const
+{
+    for (BodyPool::TemplateId id = 0; id < bodyPool.getTemplateCount(); ++id)
+    {
+        const BodyPoolStats &stats = bodyPool.getStats(id);
+        if (stats.hits + stats.misses == 0)
+            continue;
+        LOG_INFO(Physics, "Body pool '%s': %zu hits, %zu misses, %zu bodies created, %zu free, %zu live",
+                 bodyPool.getTemplate(id).name.c_str(), stats.hits, stats.misses, stats.created, stats.free,
+                 stats.live);
+    }
+}
+
 void PhysicsSystem::update(float dt)
 {
     if (!b2World_IsValid(worldId))
         return;
 
-    // Check for new entity requests from blackboard
-    if (blackboard && blackboard->has("physics_new_entity_request") &&
-        blackboard->getValue<bool>("physics_new_entity_request"))
+    // Create bodies for entities spawned this frame
+    if (events)
     {
-        Entity entity = blackboard->getValue<Entity>("physics_new_entity");
-        addEntity(entity);
-        blackboard->setValue("physics_new_entity_request", false);
+        for (const SpawnedEntityEvent &spawned : events->spawned)
+        {
+            addEntity(spawned.entity);
+        }
     }
 
     // Sync ECS data to physics world
     syncECSToPhysics();
 
     // Step the physics world
-    b2World_Step(worldId, dt, 4);
+    {
+        PROFILE_ZONE("b2World_Step");
+        b2World_Step(worldId, dt, 4);
+    }
+    simTime += dt;
 
     // Sync physics back to ECS
     syncPhysicsToECS();
+    spatialHashStale = true; // Entries catch up on the next query, not every tick
 
-    // Handle collisions
-    handleCollisions();
+    // React to the contacts Box2D found during the step
+    processCollisionEvents();
 
-    // Handle boundary collisions for obstacles
-    handleBoundaryCollisions();
+    // Hit-test ray-cast bullets against the post-step world
+    sweepProjectiles();
+}
+
+void PhysicsSystem::declareAccess(SystemAccess &access) const
+{
+    access.read<SpawnedEntityEvent, PhysicsDirtyEvent, Bullet, Input, Renderable, PhysicsBody>()
+        .write<Position, Velocity, CollisionCooldown, CommandBuffer, ProjectilePool>()
+        .write<CollisionEvent, PlayerCollisionEvent, BoundaryCollisionEvent>();
 }
 
 void PhysicsSystem::addEntity(Entity entity)
@@ -62,17 +133,23 @@ void PhysicsSystem::addEntity(Entity entity)
     if (getComponent<Input>(entity))
     {
         createPlayerBody(entity);
-        std::cout << "[PhysicsSystem] Added player entity " << entity << std::endl;
+        LOG_DEBUG(Physics, "Added player entity %u", entity);
     }
     else if (getComponent<Bullet>(entity))
     {
         createBulletBody(entity);
-        std::cout << "[PhysicsSystem] Added bullet entity " << entity << std::endl;
+        LOG_DEBUG(Physics, "Added bullet entity %u", entity);
     }
     else if (getComponent<Position>(entity) && getComponent<Velocity>(entity))
     {
         createObstacleBody(entity);
-        std::cout << "[PhysicsSystem] Added obstacle entity " << entity << std::endl;
+        LOG_DEBUG(Physics, "Added obstacle entity %u", entity);
+    }
+
+    // Bullets are left to Box2D; everything else is queryable by area
+    if (!getComponent<Bullet>(entity))
+    {
+        updateSpatialEntry(entity);
     }
 }
 
@@ -83,14 +160,42 @@ void PhysicsSystem::removeEntity(Entity entity)
     {
         entities.erase(it);
     }
+    spatialHash.remove(entity);
 
     // Remove physics body if it exists
     auto bodyIt = entityBodies.find(entity);
     if (bodyIt != entityBodies.end())
     {
-        b2DestroyBody(bodyIt->second);
+        destroyBody(entity, bodyIt->second);
         entityBodies.erase(bodyIt);
-        std::cout << "[PhysicsSystem] Removed physics body for entity " << entity << std::endl;
+        LOG_DEBUG(Physics, "Removed physics body for entity %u", entity);
+    }
+}
+
+void PhysicsSystem::onEntitiesDestroyed(const std::vector<Entity> &destroyed)
+{
+    // One pass over our entity list instead of an erase per destroyed entity
+    entities.erase(std::remove_if(entities.begin(), entities.end(),
+                                  [&](Entity entity)
+                                  { return std::binary_search(destroyed.begin(), destroyed.end(), entity); }),
+                   entities.end());
+
+    auto isDestroyed = [&](Entity entity)
+    { return std::binary_search(destroyed.begin(), destroyed.end(), entity); };
+    playerContacts.erase(std::remove_if(playerContacts.begin(), playerContacts.end(),
+                                        [&](const std::pair<Entity, Entity> &contact)
+                                        { return isDestroyed(contact.first) || isDestroyed(contact.second); }),
+                         playerContacts.end());
+
+    for (Entity entity : destroyed)
+    {
+        auto bodyIt = entityBodies.find(entity);
+        if (bodyIt != entityBodies.end())
+        {
+            destroyBody(entity, bodyIt->second);
+            entityBodies.erase(bodyIt);
+        }
+        spatialHash.remove(entity);
     }
 }
 
@@ -103,7 +208,9 @@ void PhysicsSystem::createPlayerBody(Entity entity)
     b2BodyDef bodyDef = b2DefaultBodyDef();
     bodyDef.type = b2_dynamicBody;
     bodyDef.position = pixelsToMeters(pos->x, pos->y);
-    // Note: Box2D 3.x doesn't have fixedRotation in bodyDef, we'll handle it differently
+    bodyDef.linearVelocity = initialVelocity(entity);
+    bodyDef.fixedRotation = true; // Shapes stay axis-aligned like their sprites
+    bodyDef.userData = entityToUserData(entity);
 
     b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
 
@@ -111,13 +218,16 @@ void PhysicsSystem::createPlayerBody(Entity entity)
     b2Polygon box = b2MakeBox(16.0f * METERS_PER_PIXEL, 16.0f * METERS_PER_PIXEL);
     b2ShapeDef shapeDef = b2DefaultShapeDef();
     shapeDef.density = 1.0f;
+    shapeDef.userData = entityToUserData(entity);
+    shapeDef.enableContactEvents = true; // Player-obstacle touches
+    shapeDef.enableSensorEvents = false; // Bullet sensors ignore the player
     // Note: Box2D 3.x doesn't have friction in shapeDef, it's handled differently
 
     b2CreatePolygonShape(bodyId, &shapeDef, &box);
 
     entityBodies[entity] = bodyId;
 
-    std::cout << "[PhysicsSystem] Created player body for entity " << entity << std::endl;
+    LOG_DEBUG(Physics, "Created player body for entity %u", entity);
 }
 
 void PhysicsSystem::createBulletBody(Entity entity)
@@ -126,24 +236,13 @@ void PhysicsSystem::createBulletBody(Entity entity)
     if (!pos)
         return;
 
-    b2BodyDef bodyDef = b2DefaultBodyDef();
-    bodyDef.type = b2_dynamicBody;
-    bodyDef.position = pixelsToMeters(pos->x, pos->y);
-    bodyDef.isBullet = true; // Enable continuous collision detection
-
-    b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
-
-    // Create small circle shape for bullet
-    b2Circle circle = {{0, 0}, 2.0f * METERS_PER_PIXEL};
-    b2ShapeDef shapeDef = b2DefaultShapeDef();
-    shapeDef.density = 0.1f;
-    shapeDef.isSensor = true; // Bullets are sensors for collision detection
-
-    b2CreateCircleShape(bodyId, &shapeDef, &circle);
+    b2BodyId bodyId = bodyPool.acquire(worldId, bulletTemplate, pixelsToMeters(pos->x, pos->y),
+                                       initialVelocity(entity), entityToUserData(entity));
 
     entityBodies[entity] = bodyId;
+    pooledBodies[entity] = bulletTemplate;
 
-    std::cout << "[PhysicsSystem] Created bullet body for entity " << entity << std::endl;
+    LOG_DEBUG(Physics, "Created bullet body for entity %u", entity);
 }
 
 void PhysicsSystem::createObstacleBody(Entity entity)
@@ -153,9 +252,20 @@ void PhysicsSystem::createObstacleBody(Entity entity)
     if (!pos || !renderable)
         return;
 
+    // Map obstacles choose their body type; static ones never join the solver
+    const PhysicsBody *physicsBody = getComponent<PhysicsBody>(entity);
+    BodyType type = physicsBody ? physicsBody->type : BodyType::Dynamic;
+
     b2BodyDef bodyDef = b2DefaultBodyDef();
-    bodyDef.type = b2_dynamicBody;
+    bodyDef.type = type == BodyType::Static ? b2_staticBody : type == BodyType::Kinematic ? b2_kinematicBody : b2_dynamicBody;
     bodyDef.position = pixelsToMeters(pos->x, pos->y);
+    if (type != BodyType::Static)
+    {
+        bodyDef.linearVelocity = initialVelocity(entity);
+    }
+    bodyDef.fixedRotation = true; // Shapes stay axis-aligned like their sprites
+    bodyDef.enableSleep = true;
+    bodyDef.userData = entityToUserData(entity);
 
     b2BodyId bodyId = b2CreateBody(worldId, &bodyDef);
 
@@ -165,114 +275,216 @@ void PhysicsSystem::createObstacleBody(Entity entity)
         renderable->height * 0.5f * METERS_PER_PIXEL);
     b2ShapeDef shapeDef = b2DefaultShapeDef();
     shapeDef.density = 2.0f;
+    shapeDef.userData = entityToUserData(entity);
+    shapeDef.enableContactEvents = true;
+    shapeDef.enableSensorEvents = true; // Visible to bullet sensors
 
     b2CreatePolygonShape(bodyId, &shapeDef, &box);
 
     entityBodies[entity] = bodyId;
 
-    std::cout << "[PhysicsSystem] Created obstacle body for entity " << entity << std::endl;
+    LOG_DEBUG(Physics, "Created obstacle body for entity %u", entity);
 }
 
-void PhysicsSystem::syncECSToPhysics()
+void PhysicsSystem::destroyBody(Entity entity, b2BodyId bodyId)
 {
-    for (Entity entity : entities)
+    auto pooledIt = pooledBodies.find(entity);
+    if (pooledIt == pooledBodies.end())
     {
-        auto bodyIt = entityBodies.find(entity);
-        if (bodyIt == entityBodies.end())
-            continue;
+        b2DestroyBody(bodyId);
+        return;
+    }
 
-        b2BodyId bodyId = bodyIt->second;
-        Position *pos = getComponent<Position>(entity);
-        Velocity *vel = getComponent<Velocity>(entity);
+    bodyPool.release(pooledIt->second, bodyId);
+    pooledBodies.erase(pooledIt);
+}
 
-        if (pos)
+void PhysicsSystem::syncECSToPhysics()
+{
+    // Only bodies whose components changed since the last step are written:
+    // other systems report theirs through PhysicsDirtyEvent, and this
+    // system's own post-step adjustments are in dirtyBodies. Untouched bodies
+    // keep their solver state and are allowed to sleep.
+    if (events)
+    {
+        for (const PhysicsDirtyEvent &dirty : events->physicsDirty)
         {
-            b2Vec2 position = pixelsToMeters(pos->x, pos->y);
-            b2Rot rotation = b2MakeRot(1.0f); // No rotation for top-down
-            b2Body_SetTransform(bodyId, position, rotation);
+            pushBodyState(dirty.entity);
         }
+    }
 
-        if (vel)
-        {
-            b2Vec2 velocity = {vel->x * METERS_PER_PIXEL, vel->y * METERS_PER_PIXEL};
-            b2Body_SetLinearVelocity(bodyId, velocity);
-        }
+    for (Entity entity : dirtyBodies)
+    {
+        pushBodyState(entity);
+    }
+    dirtyBodies.clear();
+}
+
+void PhysicsSystem::pushBodyState(Entity entity)
+{
+    auto bodyIt = entityBodies.find(entity);
+    if (bodyIt == entityBodies.end())
+        return;
+
+    b2BodyId bodyId = bodyIt->second;
+    Position *pos = getComponent<Position>(entity);
+    Velocity *vel = getComponent<Velocity>(entity);
+
+    if (pos)
+    {
+        b2Vec2 position = pixelsToMeters(pos->x, pos->y);
+        b2Body_SetTransform(bodyId, position, b2Rot_identity); // No rotation for top-down
+    }
+
+    if (vel)
+    {
+        b2Vec2 velocity = {vel->x * METERS_PER_PIXEL, vel->y * METERS_PER_PIXEL};
+        b2Body_SetLinearVelocity(bodyId, velocity);
     }
 }
 
 void PhysicsSystem::syncPhysicsToECS()
 {
-    for (Entity entity : entities)
+    // Box2D reports a move event for each body that moved during the step;
+    // sleeping and static bodies produce none, so this scales with activity
+    b2BodyEvents bodyEvents = b2World_GetBodyEvents(worldId);
+    for (int i = 0; i < bodyEvents.moveCount; ++i)
     {
-        auto bodyIt = entityBodies.find(entity);
-        if (bodyIt == entityBodies.end())
+        const b2BodyMoveEvent &move = bodyEvents.moveEvents[i];
+        Entity entity = entityFromUserData(move.userData);
+        if (entity == NULL_ENTITY)
             continue;
 
-        b2BodyId bodyId = bodyIt->second;
         Position *pos = getComponent<Position>(entity);
         Velocity *vel = getComponent<Velocity>(entity);
 
         if (pos)
         {
-            b2Vec2 position = b2Body_GetPosition(bodyId);
-            metersToPixels(position, pos->x, pos->y);
+            metersToPixels(move.transform.p, pos->x, pos->y);
         }
 
         if (vel)
         {
-            b2Vec2 velocity = b2Body_GetLinearVelocity(bodyId);
+            b2Vec2 velocity = b2Body_GetLinearVelocity(move.bodyId);
             vel->x = velocity.x * PIXELS_PER_METER;
             vel->y = velocity.y * PIXELS_PER_METER;
         }
     }
 }
 
-void PhysicsSystem::handleCollisions()
+void PhysicsSystem::processCollisionEvents()
 {
-    // Simple collision detection for bullet-obstacle collisions
-    for (Entity bullet : entities)
+    if (++hitStamp == 0)
     {
-        if (!getComponent<Bullet>(bullet))
-            continue;
+        // Wrapped: old stamps could collide with the new ones
+        std::fill(bulletHitStamps.begin(), bulletHitStamps.end(), 0u);
+        hitStamp = 1;
+    }
+    processSensorEvents();
+    processContactEvents();
+    handlePlayerContacts();
+}
+
+void PhysicsSystem::processSensorEvents()
+{
+    // Bullets are sensors: each begin-touch is a bullet entering an obstacle.
+    // Bullet removal is deferred to the command buffer, so it is safe here.
+    b2SensorEvents sensorEvents = b2World_GetSensorEvents(worldId);
+    for (int i = 0; i < sensorEvents.beginCount; ++i)
+    {
+        const b2SensorBeginTouchEvent &touch = sensorEvents.beginEvents[i];
+        Entity bullet = entityFromShape(touch.sensorShapeId);
+        Entity obstacle = entityFromShape(touch.visitorShapeId);
 
-        Position *bulletPos = getComponent<Position>(bullet);
-        if (!bulletPos)
+        if (bullet == NULL_ENTITY || !getComponent<Bullet>(bullet) || !isObstacle(obstacle))
             continue;
 
-        for (Entity obstacle : entities)
+        // The bullet is consumed by its first hit
+        const std::uint32_t index = entityIndex(bullet);
+        if (index >= bulletHitStamps.size())
         {
-            if (bullet == obstacle ||
-                getComponent<Bullet>(obstacle) ||
-                getComponent<Input>(obstacle))
-                continue;
+            bulletHitStamps.resize(std::max<std::size_t>(index + 1, bulletHitStamps.size() * 2), 0u);
+        }
+        if (bulletHitStamps[index] == hitStamp)
+            continue;
 
-            Position *obstaclePos = getComponent<Position>(obstacle);
-            Renderable *obstacleRend = getComponent<Renderable>(obstacle);
+        bulletHitStamps[index] = hitStamp;
+        handleBulletObstacleCollision(bullet, obstacle);
+    }
+}
 
-            if (!obstaclePos || !obstacleRend)
-                continue;
+void PhysicsSystem::processContactEvents()
+{
+    b2ContactEvents contactEvents = b2World_GetContactEvents(worldId);
 
-            // Simple bounding box collision check
-            float dx = bulletPos->x - obstaclePos->x;
-            float dy = bulletPos->y - obstaclePos->y;
+    for (int i = 0; i < contactEvents.beginCount; ++i)
+    {
+        const b2ContactBeginTouchEvent &touch = contactEvents.beginEvents[i];
+        Entity a = entityFromShape(touch.shapeIdA);
+        Entity b = entityFromShape(touch.shapeIdB);
 
-            if (abs(dx) < obstacleRend->width / 2 && abs(dy) < obstacleRend->height / 2)
-            {
-                handleBulletObstacleCollision(bullet, obstacle);
-            }
+        if (a != NULL_ENTITY && getComponent<Input>(a) && isObstacle(b))
+        {
+            playerContacts.emplace_back(a, b);
+        }
+        else if (b != NULL_ENTITY && getComponent<Input>(b) && isObstacle(a))
+        {
+            playerContacts.emplace_back(b, a);
+        }
+        else if (events && isObstacle(a) && isBoundsShape(touch.shapeIdB))
+        {
+            events->boundaryCollision.push({a});
+        }
+        else if (events && isObstacle(b) && isBoundsShape(touch.shapeIdA))
+        {
+            events->boundaryCollision.push({b});
         }
     }
 
-    // Check for player-obstacle collisions
-    for (Entity player : entities)
+    for (int i = 0; i < contactEvents.endCount; ++i)
     {
-        if (!getComponent<Input>(player))
-            continue;
+        // Shapes of destroyed bodies come back invalid; those pairs were
+        // already dropped in onEntitiesDestroyed
+        const b2ContactEndTouchEvent &touch = contactEvents.endEvents[i];
+        Entity a = entityFromShape(touch.shapeIdA);
+        Entity b = entityFromShape(touch.shapeIdB);
+
+        playerContacts.erase(std::remove_if(playerContacts.begin(), playerContacts.end(),
+                                            [&](const std::pair<Entity, Entity> &contact)
+                                            {
+                                                return (contact.first == a && contact.second == b) ||
+                                                       (contact.first == b && contact.second == a);
+                                            }),
+                             playerContacts.end());
+    }
+}
 
-        Position *playerPos = getComponent<Position>(player);
-        if (!playerPos)
+void PhysicsSystem::hashBodies(StateHash &hash) const
+{
+    // entities is in insertion order, which is the same on every run
+    for (Entity entity : entities)
+    {
+        auto it = entityBodies.find(entity);
+        if (it == entityBodies.end() || !b2Body_IsValid(it->second))
             continue;
 
+        b2Transform transform = b2Body_GetTransform(it->second);
+        b2Vec2 velocity = b2Body_GetLinearVelocity(it->second);
+        hash.add(entity);
+        hash.add(transform.p);
+        hash.add(transform.q);
+        hash.add(velocity);
+    }
+}
+
+void PhysicsSystem::handlePlayerContacts()
+{
+    // Re-check every touching pair each frame so a player resting against an
+    // obstacle is pushed again once the cooldown expires
+    // Cooldowns run on simulated time so a replay sees the same pushes
+    float currentTime = simTime;
+    for (const auto &[player, obstacle] : playerContacts)
+    {
         // Get or create collision cooldown component
         CollisionCooldown *cooldown = getComponent<CollisionCooldown>(player);
         if (!cooldown)
@@ -282,84 +494,48 @@ void PhysicsSystem::handleCollisions()
             cooldown = getComponent<CollisionCooldown>(player);
         }
 
-        // Check if still in cooldown period
-        float currentTime = SDL_GetTicks() / 1000.0f; // Convert to seconds
+        // Check if still in cooldown period; this also limits each player to
+        // one handled collision per frame
         if (currentTime - cooldown->lastCollisionTime < cooldown->cooldownDuration)
             continue;
 
-        for (Entity obstacle : entities)
-        {
-            if (player == obstacle ||
-                getComponent<Bullet>(obstacle) ||
-                getComponent<Input>(obstacle))
-                continue;
-
-            Position *obstaclePos = getComponent<Position>(obstacle);
-            Renderable *obstacleRend = getComponent<Renderable>(obstacle);
-
-            if (!obstaclePos || !obstacleRend)
-                continue;
-
-            // More precise bounding box collision check (player is 32x32, obstacle varies)
-            float dx = abs(playerPos->x - obstaclePos->x);
-            float dy = abs(playerPos->y - obstaclePos->y);
-            float playerHalfSize = 16.0f; // Player is 32x32, so half is 16
-
-            if (dx < (playerHalfSize + obstacleRend->width / 2) &&
-                dy < (playerHalfSize + obstacleRend->height / 2))
-            {
-                handlePlayerObstacleCollision(player, obstacle);
-                cooldown->lastCollisionTime = currentTime;
-                break; // Only handle one collision per frame per player
-            }
-        }
+        handlePlayerObstacleCollision(player, obstacle);
+        cooldown->lastCollisionTime = currentTime;
     }
 }
 
 void PhysicsSystem::handleBulletObstacleCollision(Entity bullet, Entity obstacle)
 {
-    // Apply impulse to obstacle
-    Velocity *obstacleVel = getComponent<Velocity>(obstacle);
-    if (obstacleVel)
+    Velocity *bulletVel = getComponent<Velocity>(bullet);
+    if (bulletVel)
     {
-        // Apply impulse based on bullet direction
-        Velocity *bulletVel = getComponent<Velocity>(bullet);
-        if (bulletVel)
-        {
-            float impulseStrength = 100.0f;
-            float bulletSpeed = sqrt(bulletVel->x * bulletVel->x + bulletVel->y * bulletVel->y);
-            if (bulletSpeed > 0)
-            {
-                obstacleVel->x += (bulletVel->x / bulletSpeed) * impulseStrength;
-                obstacleVel->y += (bulletVel->y / bulletSpeed) * impulseStrength;
-            }
-        }
+        applyBulletImpulse(obstacle, bulletVel->x, bulletVel->y);
     }
 
-    // Remove bullet immediately upon collision
-    if (manager)
-    {
-        manager->removeEntity(bullet);
-        // Remove from physics system's entity list
-        entities.erase(std::remove(entities.begin(), entities.end(), bullet), entities.end());
-        // Remove from physics bodies map
-        auto bodyIt = entityBodies.find(bullet);
-        if (bodyIt != entityBodies.end())
-        {
-            b2DestroyBody(bodyIt->second);
-            entityBodies.erase(bodyIt);
-        }
-    }
+    // Remove bullet at the end-of-tick flush; its body is released in onEntitiesDestroyed
+    commands->destroyEntity(bullet);
 
-    // Post collision event to blackboard for other systems (like MapSystem)
-    if (blackboard)
+    // Post collision event for other systems (like MapSystem)
+    if (events)
     {
-        blackboard->setValue("collision_event", true);
-        blackboard->setValue("collision_bullet", bullet);
-        blackboard->setValue("collision_obstacle", obstacle);
+        events->collision.push({bullet, obstacle});
     }
 
-    std::cout << "[PhysicsSystem] Bullet " << bullet << " hit obstacle " << obstacle << " and was removed" << std::endl;
+    LOG_DEBUG(Physics, "Bullet %u hit obstacle %u and was queued for removal", bullet, obstacle);
+}
+
+void PhysicsSystem::applyBulletImpulse(Entity obstacle, float bulletVelX, float bulletVelY)
+{
+    // Apply impulse to obstacle based on bullet direction
+    Velocity *obstacleVel = getComponent<Velocity>(obstacle);
+    float bulletSpeed = std::sqrt(bulletVelX * bulletVelX + bulletVelY * bulletVelY);
+    if (!obstacleVel || bulletSpeed <= 0 || !isDynamic(obstacle))
+        return;
+
+    float impulseStrength = 100.0f;
+    obstacleVel->x += (bulletVelX / bulletSpeed) * impulseStrength;
+    obstacleVel->y += (bulletVelY / bulletSpeed) * impulseStrength;
+    dirtyBodies.push_back(obstacle);
 }
 
 void PhysicsSystem::handlePlayerObstacleCollision(Entity player, Entity obstacle)
@@ -394,11 +570,19 @@ void PhysicsSystem::handlePlayerObstacleCollision(Entity player, Entity obstacle
             separationY = (playerPos->y > obstaclePos->y) ? overlapY : -overlapY;
         }
 
-        // Immediately separate positions to prevent overlap
-        playerPos->x += separationX * 0.6f;   // Player takes 60% of separation
-        obstaclePos->x -= separationX * 0.4f; // Obstacle takes 40% of separation
-        playerPos->y += separationY * 0.6f;
-        obstaclePos->y -= separationY * 0.4f;
+        // Immediately separate positions to prevent overlap. Static and
+        // kinematic obstacles don't give way, so the player takes all of it.
+        bool obstacleMoves = isDynamic(obstacle);
+        float playerShare = obstacleMoves ? 0.6f : 1.0f; // Player takes 60% of separation
+        playerPos->x += separationX * playerShare;
+        playerPos->y += separationY * playerShare;
+        dirtyBodies.push_back(player);
+        if (obstacleMoves)
+        {
+            obstaclePos->x -= separationX * 0.4f; // Obstacle takes 40% of separation
+            obstaclePos->y -= separationY * 0.4f;
+            dirtyBodies.push_back(obstacle);
+        }
 
         // Calculate collision direction (from obstacle to player)
         float dx = playerPos->x - obstaclePos->x;
@@ -417,114 +601,189 @@ void PhysicsSystem::handlePlayerObstacleCollision(Entity player, Entity obstacle
             playerVel->y += dy * knockbackStrength;
 
             // Apply smaller counter-impulse to obstacle
-            float obstacleImpulse = 30.0f; // Reduced from 50.0f
-            obstacleVel->x -= dx * obstacleImpulse;
-            obstacleVel->y -= dy * obstacleImpulse;
+            if (obstacleMoves)
+            {
+                float obstacleImpulse = 30.0f; // Reduced from 50.0f
+                obstacleVel->x -= dx * obstacleImpulse;
+                obstacleVel->y -= dy * obstacleImpulse;
+            }
         }
 
-        // Post player collision event to blackboard
-        if (blackboard)
+        // Post player collision event
+        if (events)
         {
-            blackboard->setValue("player_collision_event", true);
-            blackboard->setValue("player_collision_player", player);
-            blackboard->setValue("player_collision_obstacle", obstacle);
+            events->playerCollision.push({player, obstacle});
         }
 
-        std::cout << "[PhysicsSystem] Player " << player << " collided with obstacle " << obstacle
-                  << " (separation: " << separationX << ", " << separationY << ")" << std::endl;
+        LOG_DEBUG(Physics, "Player %u collided with obstacle %u (separation: %.2f, %.2f)",
+                  player, obstacle, separationX, separationY);
     }
 }
 
-void PhysicsSystem::handleBoundaryCollisions()
+void PhysicsSystem::sweepProjectiles()
 {
-    // Check all obstacles for boundary collisions
-    for (Entity entity : entities)
+    if (!projectiles || projectiles->empty())
+        return;
+
+    const int count = static_cast<int>(projectiles->size());
+    projectileHits.assign(count, NULL_ENTITY);
+
+    // Casts only read the world, so a large batch is split across the pool
+    auto castRange = [this](int begin, int end, std::size_t)
     {
-        // Skip bullets and player
-        if (getComponent<Bullet>(entity) || getComponent<Input>(entity))
-            continue;
+        for (int i = begin; i < end; ++i)
+        {
+            projectileHits[i] = castProjectile(static_cast<std::size_t>(i));
+        }
+    };
 
-        // Only check obstacles (entities with Position, Renderable, and Velocity)
-        Position *pos = getComponent<Position>(entity);
-        Renderable *renderable = getComponent<Renderable>(entity);
-        Velocity *vel = getComponent<Velocity>(entity);
+    if (threadPool && count > PROJECTILES_PER_CAST_TASK)
+    {
+        auto task = threadPool->parallelFor(count, PROJECTILES_PER_CAST_TASK, castRange);
+        threadPool->wait(*task);
+    }
+    else
+    {
+        castRange(0, count, 0);
+    }
 
-        if (!pos || !renderable || !vel)
+    // Backwards, so swap-remove only moves projectiles that were already handled
+    for (int i = count - 1; i >= 0; --i)
+    {
+        Entity obstacle = projectileHits[i];
+        if (obstacle == NULL_ENTITY)
             continue;
 
-        handleObstacleBoundaryCollision(entity);
+        applyBulletImpulse(obstacle, projectiles->getVelocityX()[i], projectiles->getVelocityY()[i]);
+        if (events)
+        {
+            events->collision.push({NULL_ENTITY, obstacle}); // Pooled bullets have no entity
+        }
+        LOG_DEBUG(Physics, "Ray-cast bullet hit obstacle %u", obstacle);
+
+        projectiles->remove(i);
     }
 }
 
-void PhysicsSystem::handleObstacleBoundaryCollision(Entity obstacle)
+Entity PhysicsSystem::castProjectile(std::size_t index) const
 {
-    Position *pos = getComponent<Position>(obstacle);
-    Renderable *renderable = getComponent<Renderable>(obstacle);
-    Velocity *vel = getComponent<Velocity>(obstacle);
+    float startX = projectiles->getPrevX()[index];
+    float startY = projectiles->getPrevY()[index];
+    b2Vec2 translation = {(projectiles->getX()[index] - startX) * METERS_PER_PIXEL,
+                          (projectiles->getY()[index] - startY) * METERS_PER_PIXEL};
+    if (translation.x == 0.0f && translation.y == 0.0f)
+        return NULL_ENTITY;
+
+    b2Vec2 origin = {startX * METERS_PER_PIXEL, startY * METERS_PER_PIXEL};
+    Entity hit = NULL_ENTITY;
+    b2World_CastRay(worldId, origin, translation, b2DefaultQueryFilter(), &PhysicsSystem::closestObstacleCallback, &hit);
+    return hit;
+}
 
-    if (!pos || !renderable || !vel)
-        return;
+float PhysicsSystem::closestObstacleCallback(b2ShapeId shapeId, b2Vec2 /*point*/, b2Vec2 /*normal*/, float fraction,
+                                             void *context)
+{
+    // Players, other bullets and sensors are not targets: -1 ignores the shape
+    Entity entity = entityFromShape(shapeId);
+    if (!isObstacle(entity))
+        return -1.0f;
+
+    // Returning the fraction clips the ray, so later reports are all closer
+    *static_cast<Entity *>(context) = entity;
+    return fraction;
+}
 
-    // Calculate boundary positions considering obstacle size
-    float halfWidth = renderable->width / 2.0f;
-    float halfHeight = renderable->height / 2.0f;
+void PhysicsSystem::setWorldBounds(float width, float height)
+{
+    if (b2Body_IsValid(boundsBodyId))
+    {
+        b2DestroyBody(boundsBodyId);
+    }
 
-    float leftBoundary = halfWidth;
-    float rightBoundary = 800 - halfWidth; // WINDOW_WIDTH = 800
-    float topBoundary = halfHeight;
-    float bottomBoundary = 600 - halfHeight; // WINDOW_HEIGHT = 600
+    b2BodyDef bodyDef = b2DefaultBodyDef();
+    bodyDef.type = b2_staticBody;
+    boundsBodyId = b2CreateBody(worldId, &bodyDef);
+
+    // Chain segments only collide on their right-hand side, so the loop
+    // runs down the left edge first to face the world's interior
+    b2Vec2 corners[4] = {pixelsToMeters(0.0f, 0.0f), pixelsToMeters(0.0f, height), pixelsToMeters(width, height),
+                         pixelsToMeters(width, 0.0f)};
+    // Chains take their surface properties from materials (one for the whole loop)
+    b2SurfaceMaterial wallMaterial = b2DefaultSurfaceMaterial();
+    wallMaterial.friction = 0.0f;
+    wallMaterial.restitution = 0.8f; // Obstacles bounce off the walls, losing 20% of their speed
+
+    b2ChainDef chainDef = b2DefaultChainDef();
+    chainDef.points = corners;
+    chainDef.count = 4;
+    chainDef.isLoop = true;
+    chainDef.materials = &wallMaterial;
+    chainDef.materialCount = 1;
+    b2CreateChain(boundsBodyId, &chainDef);
+
+    LOG_INFO(Physics, "World bounds set to %.0fx%.0f", width, height);
+}
 
-    bool bounced = false;
+bool PhysicsSystem::isBoundsShape(b2ShapeId shapeId) const
+{
+    return b2Shape_IsValid(shapeId) && B2_ID_EQUALS(b2Shape_GetBody(shapeId), boundsBodyId);
+}
 
-    // Check left and right boundaries
-    if (pos->x <= leftBoundary && vel->x < 0)
-    {
-        vel->x = -vel->x;      // Reverse horizontal velocity
-        pos->x = leftBoundary; // Keep obstacle within bounds
-        bounced = true;
-    }
-    else if (pos->x >= rightBoundary && vel->x > 0)
-    {
-        vel->x = -vel->x;       // Reverse horizontal velocity
-        pos->x = rightBoundary; // Keep obstacle within bounds
-        bounced = true;
-    }
+bool PhysicsSystem::isDynamic(Entity entity)
+{
+    const PhysicsBody *physicsBody = getComponent<PhysicsBody>(entity);
+    return !physicsBody || physicsBody->type == BodyType::Dynamic;
+}
 
-    // Check top and bottom boundaries
-    if (pos->y <= topBoundary && vel->y < 0)
-    {
-        vel->y = -vel->y;     // Reverse vertical velocity
-        pos->y = topBoundary; // Keep obstacle within bounds
-        bounced = true;
-    }
-    else if (pos->y >= bottomBoundary && vel->y > 0)
-    {
-        vel->y = -vel->y;        // Reverse vertical velocity
-        pos->y = bottomBoundary; // Keep obstacle within bounds
-        bounced = true;
-    }
+void PhysicsSystem::updateSpatialEntry(Entity entity)
+{
+    Position *pos = getComponent<Position>(entity);
+    Renderable *renderable = getComponent<Renderable>(entity);
+    if (!pos || !renderable)
+        return;
 
-    // Apply damping to prevent infinite bouncing
-    if (bounced)
-    {
-        float dampingFactor = 0.8f; // Reduce velocity by 20% on bounce
-        vel->x *= dampingFactor;
-        vel->y *= dampingFactor;
+    spatialHash.update(entity, spatialBounds(*pos, *renderable));
+}
+
+Aabb PhysicsSystem::spatialBounds(const Position &pos, const Renderable &renderable)
+{
+    // Position is the top-left corner, as the renderer and map loader use it,
+    // so a query matches the rectangle on screen
+    return {pos.x, pos.y, pos.x + renderable.width, pos.y + renderable.height};
+}
 
-        // Post boundary collision event to blackboard
-        if (blackboard)
+void PhysicsSystem::refreshSpatialHash()
+{
+    if (!spatialHashStale)
+        return;
+
+    // Incremental: only entities that crossed a cell edge are re-bucketed
+    for (Entity entity : entities)
+    {
+        if (spatialHash.contains(entity))
         {
-            blackboard->setValue("boundary_collision_event", true);
-            blackboard->setValue("boundary_collision_entity", obstacle);
+            updateSpatialEntry(entity);
         }
-
-        std::cout << "[PhysicsSystem] Obstacle " << obstacle << " bounced off boundary" << std::endl;
     }
+    spatialHashStale = false;
 }
 
-void PhysicsSystem::processCollisionEvents()
+void PhysicsSystem::queryArea(const Aabb &area, std::vector<Entity> &out)
 {
-    // Stub implementation
+    refreshSpatialHash();
+    spatialHash.queryAabb(area, out);
+}
+
+void PhysicsSystem::queryPoint(float x, float y, std::vector<Entity> &out)
+{
+    refreshSpatialHash();
+    spatialHash.queryPoint(x, y, out);
+}
+
+b2Vec2 PhysicsSystem::initialVelocity(Entity entity)
+{
+    Velocity *vel = getComponent<Velocity>(entity);
+    return vel ? b2Vec2{vel->x * METERS_PER_PIXEL, vel->y * METERS_PER_PIXEL} : b2Vec2{0.0f, 0.0f};
 }
 
 b2Vec2 PhysicsSystem::pixelsToMeters(float pixelX, float pixelY)
@@ -538,13 +797,53 @@ void PhysicsSystem::metersToPixels(const b2Vec2 &meters, float &pixelX, float &p
     pixelY = meters.y * PIXELS_PER_METER;
 }
 
-// Box2D 3.x collision callbacks
-bool beginContactCallback(b2ShapeId shapeIdA, b2ShapeId shapeIdB, b2Manifold *manifold, void *context)
+void *PhysicsSystem::entityToUserData(Entity entity)
+{
+    return reinterpret_cast<void *>(static_cast<std::uintptr_t>(entity));
+}
+
+Entity PhysicsSystem::entityFromUserData(void *userData)
+{
+    return static_cast<Entity>(reinterpret_cast<std::uintptr_t>(userData));
+}
+
+Entity PhysicsSystem::entityFromShape(b2ShapeId shapeId)
 {
-    return true;
+    if (!b2Shape_IsValid(shapeId))
+        return NULL_ENTITY;
+    return entityFromUserData(b2Shape_GetUserData(shapeId));
 }
 
-bool endContactCallback(b2ShapeId shapeIdA, b2ShapeId shapeIdB, void *context)
+void *PhysicsSystem::enqueueTask(b2TaskCallback *task, int32_t itemCount, int32_t minRange, void *taskContext,
+                                 void *userContext)
 {
-    return true;
-}
\ No newline at end of file
+    PhysicsSystem *self = static_cast<PhysicsSystem *>(userContext);
+
+    // Box2D enqueues every solver worker before finishing any of them, and
+    // those workers wait on each other, so each task has to start running
+    // now rather than when finishTask is reached
+    auto rangeTask = self->threadPool->parallelFor(itemCount, minRange, [task, taskContext](int begin, int end, std::size_t slot)
+                                                   {
+                                                       task(begin, end, static_cast<uint32_t>(slot), taskContext);
+                                                   });
+    self->physicsTasks.push_back(rangeTask);
+    return rangeTask.get();
+}
+
+void PhysicsSystem::finishTask(void *userTask, void *userContext)
+{
+    PhysicsSystem *self = static_cast<PhysicsSystem *>(userContext);
+    ThreadPool::RangeTask *rangeTask = static_cast<ThreadPool::RangeTask *>(userTask);
+    self->threadPool->wait(*rangeTask);
+
+    // Only a handful of tasks are in flight per step
+    auto it = std::find_if(self->physicsTasks.begin(), self->physicsTasks.end(),
+                           [rangeTask](const std::shared_ptr<ThreadPool::RangeTask> &task)
+                           {
+                               return task.get() == rangeTask;
+                           });
+    if (it != self->physicsTasks.end())
+    {
+        self->physicsTasks.erase(it);
+    }
+}
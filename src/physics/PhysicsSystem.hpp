@@ -1,8 +1,16 @@
 #pragma once
 #include "../core/System.hpp"
 #include "../core/Components.hpp"
+#include "../core/StateHash.hpp"
+#include "../core/ThreadPool.hpp"
+#include "../gameplay/ProjectilePool.hpp"
+#include "BodyPool.hpp"
+#include "SpatialHash.hpp"
 #include <box2d/box2d.h>
+#include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 class Manager;
 
@@ -12,12 +20,41 @@ class Manager;
 class PhysicsSystem : public System
 {
 public:
-    PhysicsSystem(Manager *mgr);
+    // With a pool, b2World_Step fans its solver stages out over the pool's threads
+    PhysicsSystem(Manager *mgr, ThreadPool *pool = nullptr);
     ~PhysicsSystem();
 
     void update(float dt) override;
+    void declareAccess(SystemAccess &access) const override;
     void addEntity(Entity entity);
     void removeEntity(Entity entity);
+    void onEntitiesDestroyed(const std::vector<Entity> &destroyed) override;
+
+    b2WorldId getWorldId() const { return worldId; }
+
+    // Bullet bodies come from a pool of disabled bodies instead of being created per shot
+    const BodyPool &getBodyPool() const { return bodyPool; }
+    BodyPool::TemplateId getBulletTemplate() const { return bulletTemplate; }
+    void warmUpBodies(BodyPool::TemplateId id, std::size_t count) { bodyPool.warmUp(worldId, id, count); }
+    void logBodyPoolStats() const;
+
+    // Fold every body's transform and velocity into a state hash (deterministic mode)
+    void hashBodies(StateHash &hash) const;
+
+    // Wall the world in with a static chain loop (map size in pixels); replaces any previous bounds
+    void setWorldBounds(float width, float height);
+
+    // Ray-cast bullets to sweep against the world after each step
+    void setProjectilePool(ProjectilePool *pool) { projectiles = pool; }
+
+    // Gameplay proximity queries over obstacles and players (not bullets). The
+    // hash is brought up to date by the first query after a step, so ticks
+    // without queries don't pay for keeping it current.
+    void setSpatialCellSize(float cellSize) { spatialHash.setCellSize(cellSize); }
+    void queryArea(const Aabb &area, std::vector<Entity> &out);
+    void queryPoint(float x, float y, std::vector<Entity> &out);
+    // The box an entity is kept under: its rendered rectangle
+    static Aabb spatialBounds(const Position &pos, const Renderable &renderable);
 
     // Physics world settings
     static constexpr float PIXELS_PER_METER = 32.0f;
@@ -25,28 +62,78 @@ public:
 
 private:
     Manager *manager;
+    ThreadPool *threadPool;
     b2WorldId worldId;
+    b2BodyId boundsBodyId = b2_nullBodyId;
+    float simTime = 0.0f; // Seconds simulated so far; drives collision cooldowns
+
+    // Range tasks Box2D has enqueued and not yet finished
+    std::vector<std::shared_ptr<ThreadPool::RangeTask>> physicsTasks;
     std::unordered_map<Entity, b2BodyId> entityBodies;
 
+    // Entities whose body came from bodyPool, and the template to return it to
+    BodyPool bodyPool;
+    BodyPool::TemplateId bulletTemplate;
+    std::unordered_map<Entity, BodyPool::TemplateId> pooledBodies;
+    SpatialHash spatialHash;
+    bool spatialHashStale = false; // Bodies moved since the hash was last refreshed
+
+    // (player, obstacle) pairs currently touching, maintained from contact begin/end events
+    std::vector<std::pair<Entity, Entity>> playerContacts;
+
+    // Entities this system changed after the step, pushed to Box2D before the next one
+    std::vector<Entity> dirtyBodies;
+
+    ProjectilePool *projectiles = nullptr;
+    std::vector<Entity> projectileHits; // Obstacle hit by each projectile this tick, or NULL_ENTITY
+
+    // Bullets already consumed this step (destruction is deferred to the flush):
+    // a bullet's entity index is marked with this step's stamp, so the check is
+    // O(1) and nothing has to be cleared between steps
+    std::vector<std::uint32_t> bulletHitStamps;
+    std::uint32_t hitStamp = 0;
+
     void createPlayerBody(Entity entity);
     void createBulletBody(Entity entity);
     void createObstacleBody(Entity entity);
+    void destroyBody(Entity entity, b2BodyId bodyId); // Returns pooled bodies to the pool
     void syncPhysicsToECS();
     void syncECSToPhysics();
-    void handleCollisions();
-    void handleBoundaryCollisions();
+    void pushBodyState(Entity entity);
+    void updateSpatialEntry(Entity entity);
+    void refreshSpatialHash();
+    bool isBoundsShape(b2ShapeId shapeId) const;
+    static bool isDynamic(Entity entity); // Obstacles without PhysicsBody are dynamic
 
     // Helper functions
+    b2Vec2 initialVelocity(Entity entity);
     b2Vec2 pixelsToMeters(float pixelX, float pixelY);
     void metersToPixels(const b2Vec2 &meters, float &pixelX, float &pixelY);
     void handleBulletObstacleCollision(Entity bullet, Entity obstacle);
+    void applyBulletImpulse(Entity obstacle, float bulletVelX, float bulletVelY);
     void handlePlayerObstacleCollision(Entity player, Entity obstacle);
-    void handleObstacleBoundaryCollision(Entity obstacle);
 
-    // Box2D 3.x doesn't use contact listeners, use collision events instead
+    // Collisions come from the events Box2D records during b2World_Step, so
+    // the cost scales with the number of touching pairs, not entities squared
     void processCollisionEvents();
-};
+    void processSensorEvents();
+    void processContactEvents();
+    void handlePlayerContacts();
+
+    // Ray-cast bullets: one b2World_CastRay per projectile over the distance
+    // it moved this tick, so fast bullets cannot tunnel through thin obstacles
+    void sweepProjectiles();
+    Entity castProjectile(std::size_t index) const;
+    static float closestObstacleCallback(b2ShapeId shapeId, b2Vec2 point, b2Vec2 normal, float fraction,
+                                         void *context);
 
-// Box2D 3.x collision callbacks
-bool beginContactCallback(b2ShapeId shapeIdA, b2ShapeId shapeIdB, b2Manifold *manifold, void *context);
-bool endContactCallback(b2ShapeId shapeIdA, b2ShapeId shapeIdB, void *context);
+    // Box2D task callbacks (b2WorldDef::enqueueTask / finishTask)
+    static void *enqueueTask(b2TaskCallback *task, int32_t itemCount, int32_t minRange, void *taskContext,
+                             void *userContext);
+    static void finishTask(void *userTask, void *userContext);
+
+    // Bodies and shapes carry their entity in userData
+    static void *entityToUserData(Entity entity);
+    static Entity entityFromUserData(void *userData);
+    static Entity entityFromShape(b2ShapeId shapeId);
+};
@@ -0,0 +1,228 @@
+#include "SpatialHash.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Keeps cell coordinates of huge or infinite query bounds inside int range
+    constexpr float COORD_LIMIT = 1.0e9f;
+}
+
+SpatialHash::SpatialHash(float size)
+    : cellSize(size > 0.0f ? size : 64.0f), inverseCellSize(1.0f / cellSize)
+{
+}
+
+void SpatialHash::setCellSize(float size)
+{
+    if (size <= 0.0f || size == cellSize)
+        return;
+
+    cellSize = size;
+    inverseCellSize = 1.0f / size;
+
+    cells.clear();
+    occupied = {0, 0, -1, -1};
+    for (std::uint32_t i = 0; i < items.size(); ++i)
+    {
+        items[i].cells = cellRange(items[i].box);
+        addToCells(i, items[i].cells);
+    }
+}
+
+void SpatialHash::insert(Entity entity, const Aabb &box)
+{
+    if (contains(entity))
+    {
+        update(entity, box);
+        return;
+    }
+
+    std::uint32_t index = static_cast<std::uint32_t>(items.size());
+    items.push_back({entity, box, cellRange(box)});
+    itemIndex.emplace(entity, index);
+    addToCells(index, items[index].cells);
+}
+
+void SpatialHash::update(Entity entity, const Aabb &box)
+{
+    auto it = itemIndex.find(entity);
+    if (it == itemIndex.end())
+    {
+        insert(entity, box);
+        return;
+    }
+
+    Item &item = items[it->second];
+    item.box = box;
+
+    CellRange range = cellRange(box);
+    if (range == item.cells)
+        return; // Still in the same cells: nothing to re-bucket
+
+    removeFromCells(it->second, item.cells);
+    item.cells = range;
+    addToCells(it->second, range);
+}
+
+void SpatialHash::remove(Entity entity)
+{
+    auto it = itemIndex.find(entity);
+    if (it == itemIndex.end())
+        return;
+
+    std::uint32_t index = it->second;
+    std::uint32_t last = static_cast<std::uint32_t>(items.size() - 1);
+    removeFromCells(index, items[index].cells);
+    itemIndex.erase(it);
+
+    // Swap-remove, then point the moved item's cells at its new index
+    if (index != last)
+    {
+        items[index] = items[last];
+        itemIndex[items[index].entity] = index;
+        renumberInCells(last, index, items[index].cells);
+    }
+    items.pop_back();
+}
+
+void SpatialHash::clear()
+{
+    items.clear();
+    itemIndex.clear();
+    cells.clear();
+    occupied = {0, 0, -1, -1};
+}
+
+void SpatialHash::queryAabb(const Aabb &box, std::vector<Entity> &out) const
+{
+    CellRange range = cellRange(box);
+    range.minX = std::max(range.minX, occupied.minX);
+    range.minY = std::max(range.minY, occupied.minY);
+    range.maxX = std::min(range.maxX, occupied.maxX);
+    range.maxY = std::min(range.maxY, occupied.maxY);
+
+    std::uint32_t stamp = ++currentStamp;
+    if (stamp == 0)
+    {
+        // Stamp wrapped around: forget old stamps so none can match by accident
+        for (const Item &item : items)
+            item.queryStamp = 0;
+        stamp = currentStamp = 1;
+    }
+
+    for (std::int32_t y = range.minY; y <= range.maxY; ++y)
+    {
+        for (std::int32_t x = range.minX; x <= range.maxX; ++x)
+        {
+            auto cell = cells.find(cellKey(x, y));
+            if (cell == cells.end())
+                continue;
+
+            for (std::uint32_t index : cell->second)
+            {
+                const Item &item = items[index];
+                if (item.queryStamp == stamp)
+                    continue;
+                item.queryStamp = stamp;
+
+                if (item.box.overlaps(box))
+                {
+                    out.push_back(item.entity);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHash::queryPoint(float x, float y, std::vector<Entity> &out) const
+{
+    // A point touches one cell, and each item appears at most once per cell
+    auto cell = cells.find(cellKey(cellCoord(x), cellCoord(y)));
+    if (cell == cells.end())
+        return;
+
+    for (std::uint32_t index : cell->second)
+    {
+        if (items[index].box.contains(x, y))
+        {
+            out.push_back(items[index].entity);
+        }
+    }
+}
+
+std::int32_t SpatialHash::cellCoord(float value) const
+{
+    float scaled = std::floor(value * inverseCellSize);
+    scaled = std::max(-COORD_LIMIT, std::min(COORD_LIMIT, scaled));
+    return static_cast<std::int32_t>(scaled);
+}
+
+SpatialHash::CellRange SpatialHash::cellRange(const Aabb &box) const
+{
+    return {cellCoord(box.minX), cellCoord(box.minY), cellCoord(box.maxX), cellCoord(box.maxY)};
+}
+
+std::uint64_t SpatialHash::cellKey(std::int32_t x, std::int32_t y)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(y);
+}
+
+void SpatialHash::addToCells(std::uint32_t index, const CellRange &range)
+{
+    if (occupied.minX > occupied.maxX)
+    {
+        occupied = range;
+    }
+    else
+    {
+        occupied.minX = std::min(occupied.minX, range.minX);
+        occupied.minY = std::min(occupied.minY, range.minY);
+        occupied.maxX = std::max(occupied.maxX, range.maxX);
+        occupied.maxY = std::max(occupied.maxY, range.maxY);
+    }
+
+    for (std::int32_t y = range.minY; y <= range.maxY; ++y)
+    {
+        for (std::int32_t x = range.minX; x <= range.maxX; ++x)
+        {
+            cells[cellKey(x, y)].push_back(index);
+        }
+    }
+}
+
+void SpatialHash::removeFromCells(std::uint32_t index, const CellRange &range)
+{
+    for (std::int32_t y = range.minY; y <= range.maxY; ++y)
+    {
+        for (std::int32_t x = range.minX; x <= range.maxX; ++x)
+        {
+            auto cell = cells.find(cellKey(x, y));
+            if (cell == cells.end())
+                continue;
+
+            // Empty buckets are kept so entities moving back and forth
+            // between cells don't reallocate them
+            std::vector<std::uint32_t> &bucket = cell->second;
+            auto it = std::find(bucket.begin(), bucket.end(), index);
+            if (it != bucket.end())
+            {
+                *it = bucket.back();
+                bucket.pop_back();
+            }
+        }
+    }
+}
+
+void SpatialHash::renumberInCells(std::uint32_t from, std::uint32_t to, const CellRange &range)
+{
+    for (std::int32_t y = range.minY; y <= range.maxY; ++y)
+    {
+        for (std::int32_t x = range.minX; x <= range.maxX; ++x)
+        {
+            std::vector<std::uint32_t> &bucket = cells[cellKey(x, y)];
+            std::replace(bucket.begin(), bucket.end(), from, to);
+        }
+    }
+}
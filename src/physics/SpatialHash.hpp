@@ -0,0 +1,93 @@
+#pragma once
+#include "../core/Entity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Axis-aligned box in pixels.
+ */
+struct Aabb
+{
+    float minX, minY, maxX, maxY;
+
+    bool overlaps(const Aabb &other) const
+    {
+        return minX <= other.maxX && maxX >= other.minX &&
+               minY <= other.maxY && maxY >= other.minY;
+    }
+
+    bool contains(float x, float y) const
+    {
+        return x >= minX && x <= maxX && y >= minY && y <= maxY;
+    }
+};
+
+/**
+ * @brief Uniform-grid spatial hash for gameplay proximity queries.
+ *
+ * Each entity is registered in every cell its box covers; cells live in a
+ * hash map, so the world has no fixed extent. Queries only visit the cells
+ * under the query box, so their cost depends on local density rather than
+ * on the total number of entities. update() only re-buckets an entity when
+ * the range of cells it covers changes, which for most moves it doesn't.
+ * Queries are const but not safe to run concurrently with each other.
+ */
+class SpatialHash
+{
+public:
+    explicit SpatialHash(float cellSize = 64.0f);
+
+    // Changing the cell size re-buckets every entity
+    void setCellSize(float size);
+    float getCellSize() const { return cellSize; }
+
+    void insert(Entity entity, const Aabb &box);
+    void update(Entity entity, const Aabb &box); // Inserts if not present
+    void remove(Entity entity);
+    void clear();
+
+    bool contains(Entity entity) const { return itemIndex.count(entity) != 0; }
+    std::size_t size() const { return items.size(); }
+
+    // Append every entity whose box overlaps the query (each at most once).
+    // Query boxes may be unbounded; they are clipped to the occupied cells.
+    void queryAabb(const Aabb &box, std::vector<Entity> &out) const;
+    void queryPoint(float x, float y, std::vector<Entity> &out) const;
+
+private:
+    struct CellRange
+    {
+        std::int32_t minX, minY, maxX, maxY;
+
+        bool operator==(const CellRange &other) const
+        {
+            return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+        }
+    };
+
+    struct Item
+    {
+        Entity entity;
+        Aabb box;
+        CellRange cells;
+        mutable std::uint32_t queryStamp = 0; // Dedups entities that span several cells
+    };
+
+    float cellSize;
+    float inverseCellSize;
+    std::vector<Item> items;                             // Dense; cells refer to items by index
+    std::unordered_map<Entity, std::uint32_t> itemIndex; // Entity -> index into items
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> cells;
+    CellRange occupied{0, 0, -1, -1}; // Grows to cover every cell ever used
+    mutable std::uint32_t currentStamp = 0;
+
+    std::int32_t cellCoord(float value) const;
+    CellRange cellRange(const Aabb &box) const;
+    static std::uint64_t cellKey(std::int32_t x, std::int32_t y);
+
+    void addToCells(std::uint32_t index, const CellRange &range);
+    void removeFromCells(std::uint32_t index, const CellRange &range);
+    void renumberInCells(std::uint32_t from, std::uint32_t to, const CellRange &range);
+};
@@ -0,0 +1,314 @@
+#include "GlyphAtlas.hpp"
+#include "../core/Log.hpp"
+#include <cstdint>
+
+namespace
+{
+    // Strokes for ' ' to '~' on a 5 x 9 grid: x 0-4 left to right, y 0-8 top
+    // to bottom, with capitals and digits on 0-6, lowercase x-height at 2 and
+    // descenders down to 8. Each glyph is a list of polylines separated by
+    // spaces, each polyline a run of "xy" digit pairs; a single point is a dot.
+    const char *const GLYPH_STROKES[] = {
+        "",                                   // ' '
+        "2024 26",                            // '!'
+        "1011 3031",                          // '"'
+        "1016 3036 0242 0444",                // '#'
+        "410103434505 2026",                  // '$'
+        "0640 0011 3546",                     // '%'
+        "4602011021220405162644",             // '&'
+        "2021",                               // '''
+        "30111536",                           // '('
+        "10313516",                           // ')'
+        "2125 0244 0442",                     // '*'
+        "2125 0343",                          // '+'
+        "252617",                             // ','
+        "0343",                               // '-'
+        "26",                                 // '.'
+        "0640",                               // '/'
+        "103041453616050110 4105",            // '0'
+        "112026 1636",                        // '1'
+        "01103041420646",                     // '2'
+        "01103041423313 334445361605",        // '3'
+        "300343 3036",                        // '4'
+        "400002324345361605",                 // '5'
+        "413010010516364544331304",           // '6'
+        "00404116",                           // '7'
+        "103041423313020110 1304051636454433", // '8'
+        "4313020110304145361605",             // '9'
+        "22 25",                              // ':'
+        "22 252617",                          // ';'
+        "410345",                             // '<'
+        "0242 0444",                          // '='
+        "014305",                             // '>'
+        "01103041422324 26",                  // '?'
+        "3423223234 34434130100105163646",    // '@'
+        "0602204246 0343",                    // 'A'
+        "06003041423303 3344453606",          // 'B'
+        "4130100105163645",                   // 'C'
+        "06003041453606",                     // 'D'
+        "40000646 0333",                      // 'E'
+        "400006 0333",                        // 'F'
+        "41301001051636454323",               // 'G'
+        "0006 4046 0343",                     // 'H'
+        "1030 2026 1636",                     // 'I'
+        "4045361605",                         // 'J'
+        "0006 4003 1446",                     // 'K'
+        "000646",                             // 'L'
+        "0600234046",                         // 'M'
+        "06004640",                           // 'N'
+        "103041453616050110",                 // 'O'
+        "06003041423303",                     // 'P'
+        "103041453616050110 2446",            // 'Q'
+        "06003041423303 2346",                // 'R'
+        "413010010213334445361605",           // 'S'
+        "0040 2026",                          // 'T'
+        "000516364540",                       // 'U'
+        "002640",                             // 'V'
+        "0006234640",                         // 'W'
+        "0046 4006",                          // 'X'
+        "002340 2326",                        // 'Y'
+        "00400646",                           // 'Z'
+        "30101636",                           // '['
+        "0046",                               // '\'
+        "10303616",                           // ']'
+        "022042",                             // '^'
+        "0747",                               // '_'
+        "1021",                               // '`'
+        "12324346 4414051636",                // 'a'
+        "0006 03123243453606",                // 'b'
+        "4332120305163645",                   // 'c'
+        "4046 4332120305163646",              // 'd'
+        "04444332120305163645",               // 'e'
+        "41302126 0232",                      // 'f'
+        "4332120304153544 4247381807",        // 'g'
+        "0006 0312324346",                    // 'h'
+        "122226 1636 20",                     // 'i'
+        "223237281807 30",                    // 'j'
+        "0006 3204 1436",                     // 'k'
+        "10202536",                           // 'l'
+        "0206 03122326 23324346",             // 'm'
+        "0206 0312324346",                    // 'n'
+        "123243453616050312",                 // 'o'
+        "0208 03123243453606",                // 'p'
+        "4248 4332120305163645",              // 'q'
+        "0206 04223243",                      // 'r'
+        "43321203143445361605",               // 's'
+        "10152636 0232",                      // 't'
+        "0205163645 4246",                    // 'u'
+        "022642",                             // 'v'
+        "0206244642",                         // 'w'
+        "0246 4206",                          // 'x'
+        "0205163544 4247381807",              // 'y'
+        "02420646",                           // 'z'
+        "30212213242536",                     // '{'
+        "2027",                               // '|'
+        "10212233242516",                     // '}'
+        "0312233241",                         // '~'
+    };
+    static_assert(sizeof(GLYPH_STROKES) / sizeof(GLYPH_STROKES[0]) == '~' - ' ' + 1, "one entry per printable character");
+
+    constexpr std::uint32_t WHITE = 0xFFFFFFFFu; // Opaque white in any 32-bit RGBA layout
+
+    // Grid point to pixel offset inside a cell (1 px margin, 2.25 px per x step, 2 px per y step)
+    int gridX(char digit) { return 1 + ((digit - '0') * 9 + 2) / 4; }
+    int gridY(char digit) { return 1 + (digit - '0') * 2; }
+
+    class Canvas
+    {
+    public:
+        Canvas(std::vector<std::uint32_t> &pixelData, int imageWidth) : pixels(pixelData), width(imageWidth) {}
+
+        // Two pixels wide, like the stroke font's old three-line "thick" strokes
+        void plotThick(int x, int y)
+        {
+            plot(x, y);
+            plot(x + 1, y);
+            plot(x, y + 1);
+        }
+
+        void line(int x0, int y0, int x1, int y1)
+        {
+            // Bresenham
+            int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+            int dy = y1 > y0 ? y0 - y1 : y1 - y0;
+            int stepX = x0 < x1 ? 1 : -1;
+            int stepY = y0 < y1 ? 1 : -1;
+            int error = dx + dy;
+            while (true)
+            {
+                plotThick(x0, y0);
+                if (x0 == x1 && y0 == y1)
+                    break;
+                int doubled = 2 * error;
+                if (doubled >= dy)
+                {
+                    error += dy;
+                    x0 += stepX;
+                }
+                if (doubled <= dx)
+                {
+                    error += dx;
+                    y0 += stepY;
+                }
+            }
+        }
+
+        void fill(int x, int y, int w, int h)
+        {
+            for (int row = y; row < y + h; ++row)
+            {
+                for (int column = x; column < x + w; ++column)
+                    plot(column, row);
+            }
+        }
+
+    private:
+        std::vector<std::uint32_t> &pixels;
+        int width;
+
+        void plot(int x, int y) { pixels[static_cast<std::size_t>(y) * width + x] = WHITE; }
+    };
+
+    void drawGlyph(Canvas &canvas, const char *strokes, int cellX, int cellY)
+    {
+        const char *p = strokes;
+        while (*p)
+        {
+            if (*p == ' ')
+            {
+                ++p;
+                continue;
+            }
+
+            // One polyline: consecutive digit pairs
+            int previousX = cellX + gridX(p[0]);
+            int previousY = cellY + gridY(p[1]);
+            p += 2;
+            if (*p == '\0' || *p == ' ')
+            {
+                canvas.fill(previousX, previousY, 2, 2);
+                continue;
+            }
+            while (*p && *p != ' ')
+            {
+                int x = cellX + gridX(p[0]);
+                int y = cellY + gridY(p[1]);
+                canvas.line(previousX, previousY, x, y);
+                previousX = x;
+                previousY = y;
+                p += 2;
+            }
+        }
+    }
+
+    SDL_FColor toFColor(SDL_Color color)
+    {
+        return {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    }
+}
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer *renderer)
+{
+    std::vector<std::uint32_t> pixels(static_cast<std::size_t>(ATLAS_WIDTH) * ATLAS_HEIGHT, 0);
+    Canvas canvas(pixels, ATLAS_WIDTH);
+
+    for (int cell = 0; cell < SOLID_CELL; ++cell)
+    {
+        drawGlyph(canvas, GLYPH_STROKES[cell], (cell % COLUMNS) * GLYPH_WIDTH, (cell / COLUMNS) * GLYPH_HEIGHT);
+    }
+    canvas.fill((SOLID_CELL % COLUMNS) * GLYPH_WIDTH, (SOLID_CELL / COLUMNS) * GLYPH_HEIGHT, GLYPH_WIDTH, GLYPH_HEIGHT);
+
+    texture = renderer ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, ATLAS_WIDTH,
+                                           ATLAS_HEIGHT)
+                       : nullptr;
+    if (!texture || !SDL_UpdateTexture(texture, nullptr, pixels.data(), ATLAS_WIDTH * 4))
+    {
+        LOG_ERROR(HUD, "Failed to create glyph atlas: %s", SDL_GetError());
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+            texture = nullptr;
+        }
+        return;
+    }
+
+    // Glyphs are drawn 1:1, so nearest sampling keeps strokes crisp
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    LOG_INFO(HUD, "Glyph atlas ready (%dx%d, %d glyphs)", ATLAS_WIDTH, ATLAS_HEIGHT, SOLID_CELL);
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    if (texture)
+    {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+SDL_FRect GlyphAtlas::cellUV(int cell, float inset) const
+{
+    const float x = static_cast<float>((cell % COLUMNS) * GLYPH_WIDTH) + inset;
+    const float y = static_cast<float>((cell / COLUMNS) * GLYPH_HEIGHT) + inset;
+    return {x / ATLAS_WIDTH, y / ATLAS_HEIGHT, (GLYPH_WIDTH - 2.0f * inset) / ATLAS_WIDTH,
+            (GLYPH_HEIGHT - 2.0f * inset) / ATLAS_HEIGHT};
+}
+
+SDL_FRect GlyphAtlas::getGlyphUV(char c) const
+{
+    if (c < ' ' || c > '~')
+    {
+        c = '?';
+    }
+    return cellUV(c - ' ', 0.0f);
+}
+
+SDL_FRect GlyphAtlas::getSolidUV() const
+{
+    // Well inside the cell, so stretched quads never sample a neighbouring glyph
+    return cellUV(SOLID_CELL, GLYPH_WIDTH / 4.0f);
+}
+
+void TextBatch::addText(const char *text, float x, float y, SDL_Color color)
+{
+    const SDL_FColor vertexColor = toFColor(color);
+    for (const char *c = text; *c; ++c)
+    {
+        if (*c != ' ')
+        {
+            addQuad({x, y, static_cast<float>(GlyphAtlas::GLYPH_WIDTH), static_cast<float>(GlyphAtlas::GLYPH_HEIGHT)},
+                    atlas->getGlyphUV(*c), vertexColor);
+        }
+        x += GlyphAtlas::GLYPH_WIDTH;
+    }
+}
+
+void TextBatch::addRect(const SDL_FRect &rect, SDL_Color color)
+{
+    addQuad(rect, atlas->getSolidUV(), toFColor(color));
+}
+
+void TextBatch::addQuad(const SDL_FRect &rect, const SDL_FRect &uv, SDL_FColor color)
+{
+    const int base = static_cast<int>(vertices.size());
+    vertices.push_back({{rect.x, rect.y}, color, {uv.x, uv.y}});
+    vertices.push_back({{rect.x + rect.w, rect.y}, color, {uv.x + uv.w, uv.y}});
+    vertices.push_back({{rect.x + rect.w, rect.y + rect.h}, color, {uv.x + uv.w, uv.y + uv.h}});
+    vertices.push_back({{rect.x, rect.y + rect.h}, color, {uv.x, uv.y + uv.h}});
+
+    for (int corner : {0, 1, 2, 0, 2, 3})
+    {
+        indices.push_back(base + corner);
+    }
+}
+
+void TextBatch::draw(SDL_Renderer *renderer)
+{
+    if (!indices.empty() && atlas->isValid())
+    {
+        SDL_RenderGeometry(renderer, atlas->getTexture(), vertices.data(), static_cast<int>(vertices.size()),
+                           indices.data(), static_cast<int>(indices.size()));
+    }
+    vertices.clear();
+    indices.clear();
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The HUD's stroke font, rasterized once into a texture.
+ *
+ * Every printable ASCII character (' ' to '~') is drawn from a table of line
+ * strokes into its own GLYPH_WIDTH x GLYPH_HEIGHT cell, in white on
+ * transparent, so text can be tinted through vertex colors. One extra cell is
+ * solid white, which lets filled rectangles share the text's draw call.
+ */
+class GlyphAtlas
+{
+public:
+    static constexpr int GLYPH_WIDTH = 12;  // Cell size and text advance, in pixels
+    static constexpr int GLYPH_HEIGHT = 20; // Cap height is 14 px, descenders use the rest
+
+    explicit GlyphAtlas(SDL_Renderer *renderer);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas &) = delete;
+    GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+    bool isValid() const { return texture != nullptr; }
+    SDL_Texture *getTexture() const { return texture; }
+
+    // Texture coordinates of a character's cell; anything outside ' '..'~' shows as '?'
+    SDL_FRect getGlyphUV(char c) const;
+    // Texture coordinates inside the solid cell
+    SDL_FRect getSolidUV() const;
+
+private:
+    static constexpr int COLUMNS = 16;
+    static constexpr int ROWS = 6; // 95 glyphs plus the solid cell
+    static constexpr int ATLAS_WIDTH = COLUMNS * GLYPH_WIDTH;
+    static constexpr int ATLAS_HEIGHT = ROWS * GLYPH_HEIGHT;
+    static constexpr int SOLID_CELL = '~' - ' ' + 1;
+
+    SDL_Texture *texture = nullptr;
+
+    SDL_FRect cellUV(int cell, float inset) const;
+};
+
+/**
+ * @brief Quads (glyphs and filled rectangles) collected over a frame and
+ * drawn with a single SDL_RenderGeometry call. Colors are per vertex, so
+ * any mix of colors still costs one call. The vertex and index arrays are
+ * reused, so a steady HUD doesn't allocate.
+ */
+class TextBatch
+{
+public:
+    explicit TextBatch(const GlyphAtlas *glyphAtlas) : atlas(glyphAtlas) {}
+
+    void addText(const char *text, float x, float y, SDL_Color color);
+    void addText(const std::string &text, float x, float y, SDL_Color color) { addText(text.c_str(), x, y, color); }
+    void addRect(const SDL_FRect &rect, SDL_Color color);
+
+    // Draw everything added since the last draw, then start over
+    void draw(SDL_Renderer *renderer);
+
+    bool empty() const { return indices.empty(); }
+    std::size_t getQuadCount() const { return vertices.size() / 4; }
+
+private:
+    const GlyphAtlas *atlas;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    void addQuad(const SDL_FRect &rect, const SDL_FRect &uv, SDL_FColor color);
+};
@@ -1,46 +1,85 @@
 #include "HUDSystem.hpp"
-#include <iostream>
-#include <sstream>
-#include <iomanip>
+#include "../core/BlackboardKeys.hpp"
+#include "../core/Log.hpp"
+#include <algorithm>
 
 HUDSystem::HUDSystem(SDL_Renderer *renderer)
-    : renderer(renderer), hudVisible(true), currentFPS(60.0f),
-      frameTimeAccumulator(0.0f), frameCount(0)
+    : renderer(renderer), hudVisible(true), atlas(std::make_unique<GlyphAtlas>(renderer)), textBatch(atlas.get()),
+      currentFPS(60.0f), frameTimeAccumulator(0.0f), frameCount(0)
 {
     lastFrameTime = std::chrono::high_resolution_clock::now();
-    std::cout << "[HUDSystem] Initialized" << std::endl;
+
+    const SDL_Color green = {0, 255, 0, 255};
+    fpsLayer.format(green, "FPS: %.1f", currentFPS);
+    helpLayers[0].setText("H: Toggle HUD", green);
+    helpLayers[1].setText("ESC: Exit Game", green);
+    helpLayers[2].setText("P: Profiler  F9: Save Trace", green);
+
+    LOG_INFO(HUD, "Initialized");
 }
 
 HUDSystem::~HUDSystem()
 {
-    std::cout << "[HUDSystem] Destroyed" << std::endl;
+    LOG_INFO(HUD, "Destroyed");
 }
 
 void HUDSystem::update(float dt)
 {
-    updateFPS(dt);
-
     // Check for HUD toggle request from blackboard
-    if (blackboard && blackboard->has("hud_toggle_request") &&
-        blackboard->getValue<bool>("hud_toggle_request"))
+    if (blackboard && blackboard->get(BlackboardKeys::HUD_TOGGLE_REQUEST))
     {
         toggleVisibility();
-        blackboard->setValue("hud_toggle_request", false);
+        blackboard->set(BlackboardKeys::HUD_TOGGLE_REQUEST, false);
+    }
+    if (blackboard && blackboard->get(BlackboardKeys::PROFILER_OVERLAY_REQUEST))
+    {
+        toggleProfiler();
+        blackboard->set(BlackboardKeys::PROFILER_OVERLAY_REQUEST, false);
     }
 }
 
+void HUDSystem::declareAccess(SystemAccess &access) const
+{
+    access.write<Blackboard>();
+}
+
 void HUDSystem::render()
 {
+    PROFILE_ZONE("HUDSystem::render");
+
+    // FPS counts rendered frames, which no longer match simulation ticks
+    auto now = std::chrono::high_resolution_clock::now();
+    updateFPS(std::chrono::duration<float>(now - lastFrameTime).count());
+    lastFrameTime = now;
+
     if (!hudVisible || !renderer)
         return;
 
     renderFPS();
+    if (profilerVisible)
+    {
+        renderProfiler();
+    }
+    flushText();
 }
 
 void HUDSystem::toggleVisibility()
 {
     hudVisible = !hudVisible;
-    std::cout << "[HUDSystem] HUD visibility toggled: " << (hudVisible ? "ON" : "OFF") << std::endl;
+    LOG_INFO(HUD, "HUD visibility toggled: %s", hudVisible ? "ON" : "OFF");
+}
+
+void HUDSystem::invalidateTextCache()
+{
+    fpsLayer.invalidate();
+    for (TextLayer &layer : helpLayers)
+    {
+        layer.invalidate();
+    }
+    for (TextLayer &layer : profilerRows)
+    {
+        layer.invalidate();
+    }
 }
 
 void HUDSystem::setVisible(bool visible)
@@ -53,6 +92,17 @@ bool HUDSystem::isVisible() const
     return hudVisible;
 }
 
+void HUDSystem::toggleProfiler()
+{
+    profilerVisible = !profilerVisible;
+    profilerRowCount = 0;
+    if (profilerVisible)
+    {
+        updateProfilerRows();
+    }
+    LOG_INFO(HUD, "Profiler overlay toggled: %s", profilerVisible ? "ON" : "OFF");
+}
+
 void HUDSystem::updateFPS(float dt)
 {
     frameTimeAccumulator += dt;
@@ -64,313 +114,83 @@ void HUDSystem::updateFPS(float dt)
         currentFPS = frameCount / frameTimeAccumulator;
         frameTimeAccumulator = 0.0f;
         frameCount = 0;
+
+        fpsLayer.format({0, 255, 0, 255}, "FPS: %.1f", currentFPS);
+        if (profilerVisible)
+        {
+            updateProfilerRows();
+        }
     }
 }
 
 void HUDSystem::renderFPS()
 {
-    // Create FPS text
-    std::stringstream ss;
-    ss << "FPS: " << std::fixed << std::setprecision(1) << currentFPS;
-    std::string fpsText = ss.str();
-
-    // Render FPS text at top-left corner
-    SDL_Color green = {0, 255, 0, 255};
-    renderText(fpsText, HUD_MARGIN, HUD_MARGIN, green);
-
-    // Render instructions
-    renderText("H: Toggle HUD", HUD_MARGIN, HUD_MARGIN + CHAR_HEIGHT + 5, green);
-    renderText("ESC: Exit Game", HUD_MARGIN, HUD_MARGIN + 2 * (CHAR_HEIGHT + 5), green);
-}
-
-void HUDSystem::renderText(const std::string &text, int x, int y, SDL_Color color)
-{
-    int currentX = x;
-
-    for (char c : text)
+    // FPS at the top-left corner, then the instructions
+    constexpr int LINE_HEIGHT = CHAR_HEIGHT + 5;
+    fpsLayer.render(renderer, textBatch, HUD_MARGIN, HUD_MARGIN);
+    for (int line = 0; line < HELP_LINE_COUNT; ++line)
     {
-        if (c == ' ')
-        {
-            currentX += CHAR_WIDTH;
-            continue;
-        }
-
-        renderCharacter(c, currentX, y, color);
-        currentX += CHAR_WIDTH;
+        helpLayers[line].render(renderer, textBatch, HUD_MARGIN, HUD_MARGIN + (line + 1) * LINE_HEIGHT);
     }
 }
 
-void HUDSystem::renderCharacter(char c, int x, int y, SDL_Color color)
+void HUDSystem::updateProfilerRows()
 {
-    // Set render color
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+    // One row per zone: ms per frame over the last PROFILER_WINDOW frames.
+    // A row whose numbers didn't move keeps its texture.
+    constexpr int NAME_CHARS = 23;
+    const SDL_Color yellow = {255, 220, 0, 255};
 
-    // Simple bitmap font rendering - just basic characters
-    // Render lines multiple times to make them thicker
-    auto renderThickLine = [&](int x1, int y1, int x2, int y2)
-    {
-        SDL_RenderLine(renderer, x1, y1, x2, y2);
-        SDL_RenderLine(renderer, x1, y1 + 1, x2, y2 + 1);
-        SDL_RenderLine(renderer, x1 + 1, y1, x2 + 1, y2);
-    };
+    Profiler::instance().computeStats(PROFILER_WINDOW, profileStats);
+    profilerRowCount = std::min(profileStats.size() + 1, MAX_PROFILER_ROWS);
 
-    switch (c)
+    profilerRows[0].format(yellow, "%-*s %6s %6s %6s", NAME_CHARS, "zone ms", "min", "avg", "p99");
+    for (std::size_t row = 1; row < profilerRowCount; ++row)
     {
-    case 'F':
-        // F shape
-        renderThickLine(x, y, x, y + CHAR_HEIGHT - 1);
-        renderThickLine(x, y, x + CHAR_WIDTH - 2, y);
-        renderThickLine(x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 3, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'P':
-        // P shape
-        renderThickLine(x, y, x, y + CHAR_HEIGHT - 1);
-        renderThickLine(x, y, x + CHAR_WIDTH - 2, y);
-        renderThickLine(x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        renderThickLine(x + CHAR_WIDTH - 2, y, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'S':
-        // S shape
-        renderThickLine(x, y, x + CHAR_WIDTH - 1, y);
-        renderThickLine(x, y, x, y + CHAR_HEIGHT / 2);
-        renderThickLine(x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        renderThickLine(x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        renderThickLine(x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'H':
-        // H shape
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'U':
-        // U shape
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'D':
-        // D shape
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 2, y);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        break;
-
-    case 'T':
-        // T shape
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'o':
-        // o shape (lowercase)
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2 + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2 + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        break;
-
-    case 'g':
-        // g shape (lowercase)
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2 + 1, x, y + CHAR_HEIGHT - 3);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2 + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT + 1);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT);
-        break;
-
-    case 'l':
-        // l shape (lowercase)
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'e':
-        // e shape (lowercase)
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2 + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2 + 1, x + CHAR_WIDTH - 1, y + 3 * CHAR_HEIGHT / 4);
-        SDL_RenderLine(renderer, x + 1, y + 3 * CHAR_HEIGHT / 4, x + CHAR_WIDTH - 2, y + 3 * CHAR_HEIGHT / 4);
-        break;
-
-    case 'x':
-        // x shape (lowercase)
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2, x, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'i':
-        // i shape (lowercase)
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT - 1);
-        // Render a small dot for the i
-        {
-            SDL_FRect dotRect = {static_cast<float>(x + CHAR_WIDTH / 2), static_cast<float>(y + CHAR_HEIGHT / 2 - 2), 2.0f, 2.0f};
-            SDL_RenderFillRect(renderer, &dotRect);
-        }
-        break;
-
-    case 't':
-        // t shape (lowercase)
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y + 1, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'G':
-        // G shape
-        SDL_RenderLine(renderer, x + 1, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x, y + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'a':
-        // a shape (lowercase)
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + 3 * CHAR_HEIGHT / 4, x + CHAR_WIDTH - 2, y + 3 * CHAR_HEIGHT / 4);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2 + 1, x, y + 3 * CHAR_HEIGHT / 4 - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2 + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'm':
-        // m shape (lowercase)
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 3, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH / 3, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + 2 * CHAR_WIDTH / 3, y + CHAR_HEIGHT / 2, x + 2 * CHAR_WIDTH / 3, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 'E':
-        // E shape
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 'C':
-        // C shape
-        SDL_RenderLine(renderer, x + 1, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x, y + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case ':':
-        // Colon
-        {
-            SDL_FRect dot1 = {static_cast<float>(x + CHAR_WIDTH / 2 - 1), static_cast<float>(y + CHAR_HEIGHT / 3), 3.0f, 3.0f};
-            SDL_FRect dot2 = {static_cast<float>(x + CHAR_WIDTH / 2 - 1), static_cast<float>(y + 2 * CHAR_HEIGHT / 3), 3.0f, 3.0f};
-            SDL_RenderFillRect(renderer, &dot1);
-            SDL_RenderFillRect(renderer, &dot2);
-        }
-        break;
-
-    default:
-        // For digits, use the digit renderer
-        if (c >= '0' && c <= '9')
-        {
-            renderDigit(c - '0', x, y, color);
-        }
-        else
-        {
-            // Unknown character - render as a small rectangle
-            SDL_FRect rect = {static_cast<float>(x), static_cast<float>(y + CHAR_HEIGHT / 2), static_cast<float>(CHAR_WIDTH / 2), static_cast<float>(CHAR_HEIGHT / 4)};
-            SDL_RenderFillRect(renderer, &rect);
-        }
-        break;
+        const Profiler::ZoneStats &zone = profileStats[row - 1];
+        profilerRows[row].format(yellow, "%-*.*s %6.2f %6.2f %6.2f", NAME_CHARS, NAME_CHARS, zone.name, zone.minMs,
+                                 zone.avgMs, zone.p99Ms);
     }
 }
 
-void HUDSystem::renderDigit(int digit, int x, int y, SDL_Color color)
+void HUDSystem::renderProfiler()
 {
-    // Set render color
-    SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-
-    // Render lines multiple times to make them thicker
-    auto renderThickLine = [&](int x1, int y1, int x2, int y2)
+    // The table's text comes from cached rows; the backdrop and a bar for
+    // each zone's average (so the expensive ones stand out) are quads
+    constexpr int LINE_HEIGHT = CHAR_HEIGHT + 5;
+    constexpr int TABLE_CHARS = 45;
+    const SDL_Color yellow = {255, 220, 0, 255};
+    const SDL_Color backdrop = {0, 0, 0, 160};
+    const int barX = HUD_MARGIN + TABLE_CHARS * CHAR_WIDTH;
+    const int top = HUD_MARGIN + 5 * LINE_HEIGHT;
+
+    // Room for a 60 fps frame's bar
+    SDL_FRect panel = {static_cast<float>(HUD_MARGIN - 4), static_cast<float>(top - 4),
+                       barX - HUD_MARGIN + 8 + PROFILER_BAR_SCALE * 1000.0f / 60.0f,
+                       std::max<std::size_t>(profilerRowCount, 1) * static_cast<float>(LINE_HEIGHT) + 4.0f};
+    textBatch.addRect(panel, backdrop);
+
+    for (std::size_t row = 1; row < profilerRowCount; ++row)
     {
-        SDL_RenderLine(renderer, x1, y1, x2, y2);
-        SDL_RenderLine(renderer, x1, y1 + 1, x2, y2 + 1);
-        SDL_RenderLine(renderer, x1 + 1, y1, x2 + 1, y2);
-    };
+        SDL_FRect bar = {static_cast<float>(barX), static_cast<float>(top + row * LINE_HEIGHT + 2),
+                         static_cast<float>(profileStats[row - 1].avgMs) * PROFILER_BAR_SCALE,
+                         static_cast<float>(CHAR_HEIGHT - 4)};
+        textBatch.addRect(bar, yellow);
+    }
 
-    switch (digit)
+    // The layers flush these quads first, so the backdrop stays underneath
+    for (std::size_t row = 0; row < profilerRowCount; ++row)
     {
-    case 0:
-        renderThickLine(x + 1, y, x + CHAR_WIDTH - 2, y);
-        renderThickLine(x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        renderThickLine(x, y + 1, x, y + CHAR_HEIGHT - 2);
-        renderThickLine(x + CHAR_WIDTH - 1, y + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        break;
-
-    case 1:
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2, y, x + CHAR_WIDTH / 2, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH / 2 - 1, y + 1, x + CHAR_WIDTH / 2, y);
-        break;
-
-    case 2:
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 3:
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 4:
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        break;
-
-    case 5:
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x, y, x, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        SDL_RenderLine(renderer, x, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 6:
-        SDL_RenderLine(renderer, x + 1, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x, y + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT / 2 + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        break;
-
-    case 7:
-        SDL_RenderLine(renderer, x, y, x + CHAR_WIDTH - 1, y);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 1);
-        break;
+        profilerRows[row].render(renderer, textBatch, HUD_MARGIN, static_cast<float>(top + row * LINE_HEIGHT));
+    }
+}
 
-    case 8:
-        SDL_RenderLine(renderer, x + 1, y, x + CHAR_WIDTH - 2, y);
-        SDL_RenderLine(renderer, x, y + 1, x, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        break;
+void HUDSystem::renderText(const std::string &text, int x, int y, SDL_Color color)
+{
+    textBatch.addText(text, static_cast<float>(x), static_cast<float>(y), color);
+}
 
-    case 9:
-        SDL_RenderLine(renderer, x + 1, y, x + CHAR_WIDTH - 2, y);
-        SDL_RenderLine(renderer, x, y + 1, x, y + CHAR_HEIGHT / 2 - 1);
-        SDL_RenderLine(renderer, x + CHAR_WIDTH - 1, y + 1, x + CHAR_WIDTH - 1, y + CHAR_HEIGHT - 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT / 2, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT / 2);
-        SDL_RenderLine(renderer, x + 1, y + CHAR_HEIGHT - 1, x + CHAR_WIDTH - 2, y + CHAR_HEIGHT - 1);
-        break;
-    }
+void HUDSystem::flushText()
+{
+    textBatch.draw(renderer);
 }
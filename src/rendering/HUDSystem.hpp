@@ -1,12 +1,23 @@
 #pragma once
 #include "../core/System.hpp"
 #include "../core/Components.hpp"
+#include "../core/Profiler.hpp"
+#include "GlyphAtlas.hpp"
+#include "TextLayer.hpp"
 #include <SDL3/SDL.h>
 #include <string>
 #include <chrono>
+#include <memory>
+#include <vector>
 
 /**
- * @brief HUD system for displaying game information like FPS
+ * @brief HUD system for displaying game information like FPS, plus an
+ * optional per-zone profiler breakdown (min/avg/p99 ms per frame).
+ *
+ * Every line of HUD text is a TextLayer: it is formatted only when its
+ * value is refreshed (every FPS_UPDATE_INTERVAL at most) and re-rasterized
+ * only when the string actually changed; otherwise a frame costs one
+ * texture blit per line.
  */
 class HUDSystem : public System
 {
@@ -15,33 +26,56 @@ public:
     ~HUDSystem();
 
     void update(float dt) override;
+    void declareAccess(SystemAccess &access) const override;
     void render();
     void toggleVisibility();
     void setVisible(bool visible);
     bool isVisible() const;
+    void toggleProfiler();
+
+    // Render-target contents were lost (SDL_EVENT_RENDER_TARGETS_RESET): redraw the cached text
+    void invalidateTextCache();
+
+    // Queue one-off text in the HUD's stroke font; queued text is drawn by flushText() in one call
+    void renderText(const std::string &text, int x, int y, SDL_Color color);
+    void flushText();
 
 private:
     SDL_Renderer *renderer;
     bool hudVisible;
 
+    // Every HUD glyph and panel rectangle goes through one batch per frame
+    std::unique_ptr<GlyphAtlas> atlas;
+    TextBatch textBatch;
+
     // FPS tracking
     std::chrono::high_resolution_clock::time_point lastFrameTime;
     float currentFPS;
     float frameTimeAccumulator;
     int frameCount;
 
-    // Text rendering (simple bitmap font approach)
-    void renderText(const std::string &text, int x, int y, SDL_Color color);
+    // Cached text: the FPS line, the fixed help lines and the profiler table
+    static constexpr int HELP_LINE_COUNT = 3;
+    static constexpr std::size_t MAX_PROFILER_ROWS = 24; // Header included; further zones are not shown
+    TextLayer fpsLayer;
+    TextLayer helpLayers[HELP_LINE_COUNT];
+    TextLayer profilerRows[MAX_PROFILER_ROWS];
+    std::size_t profilerRowCount = 0;
+
+    // Profiler breakdown, refreshed together with the FPS
+    bool profilerVisible = false;
+    std::vector<Profiler::ZoneStats> profileStats;
+
     void renderFPS();
     void updateFPS(float dt);
-
-    // Simple bitmap font character rendering
-    void renderCharacter(char c, int x, int y, SDL_Color color);
-    void renderDigit(int digit, int x, int y, SDL_Color color);
+    void updateProfilerRows();
+    void renderProfiler();
 
     // Constants
-    static constexpr int CHAR_WIDTH = 12;
-    static constexpr int CHAR_HEIGHT = 16;
+    static constexpr int CHAR_WIDTH = GlyphAtlas::GLYPH_WIDTH;
+    static constexpr int CHAR_HEIGHT = 16; // Line spacing is CHAR_HEIGHT + 5
     static constexpr int HUD_MARGIN = 10;
     static constexpr float FPS_UPDATE_INTERVAL = 0.25f; // Update FPS display 4 times per second
+    static constexpr std::size_t PROFILER_WINDOW = 120;  // Frames the breakdown is computed over
+    static constexpr float PROFILER_BAR_SCALE = 12.0f;   // Bar pixels per millisecond
 };
@@ -1,16 +1,17 @@
 #include "Renderer.hpp"
 #include "../core/Manager.hpp"
-#include <iostream>
+#include "../core/Log.hpp"
+#include "../core/Profiler.hpp"
 #include <cmath>
 
 Renderer::Renderer(SDL_Renderer *sdlRenderer) : renderer(sdlRenderer)
 {
-    std::cout << "[Renderer] Initialized" << std::endl;
+    LOG_INFO(Rendering, "Renderer initialized");
 }
 
 Renderer::~Renderer()
 {
-    std::cout << "[Renderer] Destroyed" << std::endl;
+    LOG_INFO(Rendering, "Renderer destroyed");
 }
 
 void Renderer::beginFrame()
@@ -20,6 +21,8 @@ void Renderer::beginFrame()
 
 void Renderer::endFrame()
 {
+    // With vsync on this is where the frame waits for the display
+    PROFILE_ZONE("SDL_RenderPresent");
     SDL_RenderPresent(renderer);
 }
 
@@ -47,18 +50,39 @@ void Renderer::renderEntity(Entity entity, const Position &pos, const Renderable
     }
 }
 
-void Renderer::renderAllEntities(const std::vector<Entity> &entities)
+void Renderer::renderAllEntities(float alpha)
 {
-    for (const auto &entity : entities)
-    {
-        Position *pos = getComponent<Position>(entity);
-        Renderable *renderable = getComponent<Renderable>(entity);
-
-        if (!pos || !renderable)
-            continue;
+    // Every positioned entity carries a PreviousPosition (see Components.hpp),
+    // so the view yields it directly instead of a lookup per entity
+    view<Position, Renderable, PreviousPosition>().each(
+        [&](Entity entity, Position &pos, Renderable &renderable, PreviousPosition &previous)
+        {
+            // Blend between the last two simulation ticks
+            Position drawn = {previous.x + (pos.x - previous.x) * alpha, previous.y + (pos.y - previous.y) * alpha};
+            renderEntity(entity, drawn, renderable);
+        });
+}
 
-        renderEntity(entity, *pos, *renderable);
+void Renderer::renderProjectiles(const ProjectilePool &projectiles, float alpha)
+{
+    if (projectiles.empty())
+        return;
+
+    // Same look as entity bullets (4x4 yellow), submitted as one batch
+    const std::size_t count = projectiles.size();
+    const float *x = projectiles.getX();
+    const float *y = projectiles.getY();
+    const float *prevX = projectiles.getPrevX();
+    const float *prevY = projectiles.getPrevY();
+
+    projectileRects.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        projectileRects[i] = {prevX[i] + (x[i] - prevX[i]) * alpha, prevY[i] + (y[i] - prevY[i]) * alpha, 4.0f, 4.0f};
     }
+
+    setColor("yellow");
+    SDL_RenderFillRects(renderer, projectileRects.data(), static_cast<int>(projectileRects.size()));
 }
 
 void Renderer::renderDirectionLine(const Position &pos, const Direction &dir, int entityWidth, int entityHeight)
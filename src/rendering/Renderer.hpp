@@ -1,6 +1,7 @@
 #pragma once
 #include "../core/Components.hpp"
 #include "../core/Entity.hpp"
+#include "../gameplay/ProjectilePool.hpp"
 #include <SDL3/SDL.h>
 #include <vector>
 
@@ -20,7 +21,8 @@ public:
 
     // Entity rendering
     void renderEntity(Entity entity, const Position &pos, const Renderable &renderable);
-    void renderAllEntities(const std::vector<Entity> &entities);
+    void renderAllEntities(float alpha = 1.0f); // Every entity with Position, PreviousPosition and Renderable
+    void renderProjectiles(const ProjectilePool &projectiles, float alpha = 1.0f);
 
     // Specialized rendering
     void renderDirectionLine(const Position &pos, const Direction &dir, int entityWidth, int entityHeight);
@@ -33,6 +35,7 @@ public:
 
 private:
     SDL_Renderer *renderer;
+    std::vector<SDL_FRect> projectileRects; // Reused every frame
 
     // Color mapping
     void parseColor(const std::string &colorName, int &r, int &g, int &b, int &a);
@@ -1,16 +1,17 @@
 #include "RenderingSystem.hpp"
 #include "../core/Manager.hpp"
-#include <iostream>
+#include "../core/Log.hpp"
+#include "../core/Profiler.hpp"
 
 RenderingSystem::RenderingSystem(SDL_Renderer *sdlRenderer, Manager *mgr)
     : manager(mgr), renderer(std::make_unique<Renderer>(sdlRenderer))
 {
-    std::cout << "[RenderingSystem] Initialized" << std::endl;
+    LOG_INFO(Rendering, "Initialized");
 }
 
 RenderingSystem::~RenderingSystem()
 {
-    std::cout << "[RenderingSystem] Destroyed" << std::endl;
+    LOG_INFO(Rendering, "Destroyed");
 }
 
 void RenderingSystem::update(float dt)
@@ -19,15 +20,25 @@ void RenderingSystem::update(float dt)
     // For now, main rendering happens in render()
 }
 
-void RenderingSystem::render()
+void RenderingSystem::declareAccess(SystemAccess & /*access*/) const
 {
-    renderer->beginFrame();
+    // Drawing happens in render() on the main thread, outside the scheduler
+}
 
-    // Get all entities from manager
-    std::vector<Entity> allEntities = manager->getAllEntities();
+void RenderingSystem::render(float alpha)
+{
+    PROFILE_ZONE("RenderingSystem::render");
+    renderer->beginFrame();
 
     // Render all entities with Position and Renderable components
-    renderer->renderAllEntities(allEntities);
+    renderer->renderAllEntities(alpha);
+    if (projectiles)
+    {
+        renderer->renderProjectiles(*projectiles, alpha);
+    }
+}
 
+void RenderingSystem::present()
+{
     renderer->endFrame();
 }
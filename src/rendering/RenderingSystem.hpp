@@ -16,7 +16,12 @@ public:
     ~RenderingSystem();
 
     void update(float dt) override;
-    void render();
+    void declareAccess(SystemAccess &access) const override;
+    void render(float alpha = 1.0f); // alpha: interpolation between previous and current tick
+    void present();                  // Show the frame; call after everything (HUD included) is drawn
+
+    // Ray-cast bullets are not entities, so they are drawn from their pool
+    void setProjectilePool(const ProjectilePool *pool) { projectiles = pool; }
 
     // Access to renderer for direct rendering needs
     Renderer *getRenderer() { return renderer.get(); }
@@ -24,4 +29,5 @@ public:
 private:
     Manager *manager;
     std::unique_ptr<Renderer> renderer;
+    const ProjectilePool *projectiles = nullptr;
 };
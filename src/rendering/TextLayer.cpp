@@ -0,0 +1,104 @@
+#include "TextLayer.hpp"
+#include "GlyphAtlas.hpp"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+TextLayer::~TextLayer()
+{
+    if (texture)
+    {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+bool TextLayer::setText(const char *newText, SDL_Color newColor)
+{
+    std::size_t newLength = 0;
+    while (newLength < MAX_LENGTH && newText[newLength] != '\0')
+    {
+        ++newLength;
+    }
+    const bool sameColor = newColor.r == color.r && newColor.g == color.g && newColor.b == color.b &&
+                           newColor.a == color.a;
+    if (sameColor && newLength == length && std::memcmp(text, newText, newLength) == 0)
+        return false;
+
+    std::memcpy(text, newText, newLength);
+    text[newLength] = '\0';
+    length = newLength;
+    color = newColor;
+    dirty = true;
+    return true;
+}
+
+bool TextLayer::format(SDL_Color newColor, const char *fmt, ...)
+{
+    char buffer[MAX_LENGTH + 1];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return setText(buffer, newColor);
+}
+
+void TextLayer::render(SDL_Renderer *renderer, TextBatch &batch, float x, float y)
+{
+    if (length == 0 || !renderer)
+        return;
+
+    // Anything already queued is meant to sit underneath this layer
+    if (!batch.empty())
+    {
+        batch.draw(renderer);
+    }
+
+    if (dirty && !rasterize(renderer, batch))
+    {
+        // No render target: draw the glyphs this frame instead
+        batch.addText(text, x, y, color);
+        batch.draw(renderer);
+        return;
+    }
+
+    const float width = static_cast<float>(length * GlyphAtlas::GLYPH_WIDTH);
+    const float height = static_cast<float>(GlyphAtlas::GLYPH_HEIGHT);
+    const SDL_FRect source = {0.0f, 0.0f, width, height};
+    const SDL_FRect destination = {x, y, width, height};
+    SDL_RenderTexture(renderer, texture, &source, &destination);
+}
+
+bool TextLayer::rasterize(SDL_Renderer *renderer, TextBatch &batch)
+{
+    if (!texture || capacity < static_cast<int>(length))
+    {
+        if (texture)
+        {
+            SDL_DestroyTexture(texture);
+        }
+        capacity = (static_cast<int>(length) + CAPACITY_STEP - 1) / CAPACITY_STEP * CAPACITY_STEP;
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                    capacity * GlyphAtlas::GLYPH_WIDTH, GlyphAtlas::GLYPH_HEIGHT);
+        if (!texture)
+        {
+            capacity = 0;
+            return false;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    }
+
+    SDL_Texture *previousTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, texture))
+        return false;
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    batch.addText(text, 0.0f, 0.0f, color);
+    batch.draw(renderer);
+    SDL_SetRenderTarget(renderer, previousTarget);
+
+    dirty = false;
+    ++rasterizeCount;
+    return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+
+class TextBatch;
+
+/**
+ * @brief One line of HUD text cached in a render-target texture.
+ *
+ * The text lives in a fixed buffer and is only re-rasterized (through the
+ * glyph atlas, into the layer's texture) when setText()/format() actually
+ * change the string or its color. Every other frame render() is a single
+ * texture blit. format() writes straight into a stack buffer, so updating a
+ * layer never touches the heap.
+ *
+ * If the renderer can't provide a render target, the layer falls back to
+ * drawing its glyphs directly each frame.
+ */
+class TextLayer
+{
+public:
+    static constexpr std::size_t MAX_LENGTH = 95; // Characters; longer text is cut off
+
+    TextLayer() = default;
+    ~TextLayer();
+
+    TextLayer(const TextLayer &) = delete;
+    TextLayer &operator=(const TextLayer &) = delete;
+
+    // Both return true if the layer changed and will be re-rasterized
+    bool setText(const char *newText, SDL_Color newColor);
+    bool format(SDL_Color newColor, const char *fmt, ...)
+#if defined(__GNUC__) || defined(__clang__)
+        __attribute__((format(printf, 3, 4)))
+#endif
+        ;
+
+    // The texture's contents are gone (SDL_EVENT_RENDER_TARGETS_RESET); redraw on next use
+    void invalidate() { dirty = true; }
+
+    void render(SDL_Renderer *renderer, TextBatch &batch, float x, float y);
+
+    const char *getText() const { return text; }
+    std::uint64_t getRasterizeCount() const { return rasterizeCount; }
+
+private:
+    static constexpr int CAPACITY_STEP = 16; // Texture widths grow in steps of this many characters
+
+    char text[MAX_LENGTH + 1] = {};
+    std::size_t length = 0;
+    SDL_Color color = {255, 255, 255, 255};
+    bool dirty = true;
+
+    SDL_Texture *texture = nullptr;
+    int capacity = 0; // Characters the texture is wide enough for
+    std::uint64_t rasterizeCount = 0;
+
+    bool rasterize(SDL_Renderer *renderer, TextBatch &batch);
+};